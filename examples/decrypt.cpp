@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <eccrypto.h>
@@ -22,26 +23,30 @@ int main(int argc, char** argv) {
     const auto cipFil = string(argv[2]);
     const auto mesFil = string(argv[3]);
 
-    const auto F = make_shared<PrimeField<V>>
-        (V("1461501637330902918203684832716283019653785059327"));
+    static constexpr V a = -3_bi;
+    static constexpr V b =
+        163235791306168110546604919403271579530548345413_bi;
+    static constexpr V B_x =
+        425826231723888350446541592701409065913635568770_bi;
+    static constexpr V B_y =
+        203520114162904107873991457957346892027982641970_bi;
+    static constexpr V l =
+        1461501637330902918203687197606826779884643492439_bi;
+
+    const auto F = make_shared<SpecialPrimeField<V, secp160r1>>();
     const auto fe = make_factory<element<V>>(F.get());
-    const auto E = make_shared<EllipticCurve<V>>(
-        F.get(),
-        fe(V(-3)),
-        fe(V("163235791306168110546604919403271579530548345413"))
-    );
+    const auto E = make_shared<EllipticCurve<V>>(F.get(), fe(a), fe(b));
 
     const auto rp = make_factory<rational_point<V>>(E.get());
-    const auto B = rp(
-        fe(V("425826231723888350446541592701409065913635568770")),
-        fe(V("203520114162904107873991457957346892027982641970"))
-    );
-    const auto G = make_shared<PrimeField<V>>
-        (V("1461501637330902918203687197606826779884643492439"));
+    const auto B = rp(fe(B_x), fe(B_y));
+    const auto G = make_shared<PrimeField<V>>(l);
     const auto ge = make_factory<element<V>>(G.get());
 
-    const auto ascTexToNums = [] (const string& ascTex) -> vector<V> {
-        vector<V> nums;
+    const auto ascTexToNums = [] (
+        const string& ascTex,
+        vector<uint8_t>*const heaBytes
+    ) -> vector<V> {
+        vector<uint8_t> bytes;
         concatinate(
             make_shared<InputProcess<int>>
                 (input_from(make_getter_from_range<int>(ascTex.begin(), ascTex.end()))),
@@ -49,14 +54,21 @@ int main(int argc, char** argv) {
                 (base64_decode()),
             make_shared<InputOutputProcess<bool, int>>
                 (bits_to_bytes()),
-            make_shared<InputOutputProcess<int, V>>
-                (bytes_to_numbers<V>()),
-            make_shared<OutputProcess<V>>
-                (output_to(make_putter_from_iterator<V>(back_inserter(nums))))
+            make_shared<OutputProcess<int>>
+                (output_to(make_putter_from_iterator<int>(back_inserter(bytes))))
         )->run();
+        const auto heaSiz = heaBytes->size();
+        if (
+            bytes.size() < heaSiz ||
+            (bytes.size() - heaSiz) % LOGICAL_SIZE_OF<V>() != 0
+        ) return vector<V>();
+        copy(bytes.begin(), bytes.begin() + heaSiz, heaBytes->begin());
+        vector<V> nums((bytes.size() - heaSiz) / LOGICAL_SIZE_OF<V>());
+        bytes_to_numbers<V>(bytes.data() + heaSiz, nums.size(), nums.data());
         return nums;
     };
-    const auto priKey_nums = ascTexToNums(priKey);
+    auto priKey_heaBytes = vector<uint8_t>();
+    const auto priKey_nums = ascTexToNums(priKey, &priKey_heaBytes);
     if (priKey_nums.size() != 1) {
         cerr << "error: invalid privateKey" << endl;
         return 1;
@@ -68,6 +80,24 @@ int main(int argc, char** argv) {
         cerr << "error: failed to open cipherFile" << endl;
         return 1;
     }
+    uint8_t R_bytes[1 + LOGICAL_SIZE_OF<V>()];
+    if (!cipIS.read(reinterpret_cast<char*>(R_bytes), sizeof(R_bytes))) {
+        cerr << "error: invalid cipherFile" << endl;
+        return 1;
+    }
+    V R_x;
+    bytes_to_numbers<V>(R_bytes + 1, 1, &R_x);
+    rational_point<V> R;
+    if (
+        (R_bytes[0] != 2 && R_bytes[0] != 3) ||
+        R_x >= F->order() ||
+        !rational_point<V>::decompress(E.get(), fe(R_x), R_bytes[0] == 3, &R)
+    ) {
+        cerr << "error: invalid cipherFile" << endl;
+        return 1;
+    }
+    const auto K = (d * R).project();
+
     ofstream mesOS(mesFil, ios::out | ios::binary);
     if (!mesOS) {
         cerr << "error: failed to open messageFile" << endl;
@@ -80,13 +110,10 @@ int main(int argc, char** argv) {
         make_shared<InputOutputProcess<int, V>>
             (bytes_to_numbers<V>()),
         make_shared<InputOutputProcess<V, V>>(
-            [&d, &rp, &fe] (
+            [&fe, &K] (
                 const get_number<V>& getNum,
                 const put_number<V>& putNum
             ) {
-                const auto R_x = fe(getNum()), R_y = fe(getNum());
-                const auto R = rp(R_x, R_y);
-                const auto K = (d * R).project();
                 for (;;) putNum((fe(getNum()) - K.x()).value());
             }
         ),
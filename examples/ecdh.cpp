@@ -16,14 +16,17 @@ int main(int argc, char** argv) {
     auto G = std::make_shared<ecc::PrimeField<int>>(11);
     auto ge = ecc::make_factory<ecc::element<int>>(G.get());
 
+    // 基準点の事前計算表の構築
+    auto T = std::make_shared<ecc::FixedBaseTable<int>>(B);
+
     // 乱数の生成
     auto rng = std::make_shared<ecc::RandomNumberGenerator<int>>();
     auto r_a = ge(rng->getNumber(1, G->order() - 1));
     auto r_b = ge(rng->getNumber(1, G->order() - 1));
 
     // 乱数によるスカラー倍点の計算
-    auto R_a = r_a * B;
-    auto R_b = r_b * B;
+    auto R_a = T->multiply(r_a);
+    auto R_b = T->multiply(r_b);
 
     // 鍵の計算
     auto K_a = r_a * R_b;
@@ -18,10 +18,13 @@ int main(int argc, char** argv) {
     auto G = std::make_shared<ecc::PrimeField<int>>(11);
     auto ge = ecc::make_factory<ecc::element<int>>(G.get());
 
+    // 基準点の事前計算表の構築
+    auto T = std::make_shared<ecc::FixedBaseTable<int>>(B);
+
     // 鍵の生成
     auto rng = std::make_shared<ecc::RandomNumberGenerator<int>>();
     auto d_a = ge(rng->getNumber(1, G->order() - 1));
-    auto P_a = d_a * B;
+    auto P_a = T->multiply(d_a);
 
     // 平文の作成
     std::vector<ecc::element<int>> M;
@@ -61,13 +64,13 @@ int main(int argc, char** argv) {
     ecc::rational_point<int> U_a;
     do {
         r_a = ge(rng->getNumber(1, G->order() - 1));
-        U_a = (r_a * B).project();
+        U_a = T->multiply(r_a).project();
         u_a = (h + ge(U_a.x()) * d_a) / r_a;
     } while (!u_a);
 
     // 検証
     auto u_b = ge(1) / u_a;
-    auto U_b = h * u_b * B + ge(U_a.x()) * u_b * P_a;
+    auto U_b = T->multiply(h * u_b) + ge(U_a.x()) * u_b * P_a;
 
     // 結果の表示
     std::cout << "F->order(): " << F->order() << std::endl;
@@ -17,14 +17,17 @@ int main(int argc, char** argv) {
     auto G = std::make_shared<ecc::PrimeField<int>>(11);
     auto ge = ecc::make_factory<ecc::element<int>>(G.get());
 
+    // 基準点の事前計算表の構築
+    auto T = std::make_shared<ecc::FixedBaseTable<int>>(B);
+
     // 鍵の生成
     auto rng = std::make_shared<ecc::RandomNumberGenerator<int>>();
     auto d_b = ge(rng->getNumber(1, G->order() - 1));
-    auto P_b = d_b * B;
+    auto P_b = T->multiply(d_b);
 
     // 暗号化
     auto r_a = ge(rng->getNumber(1, G->order() - 1));
-    auto R_a = r_a * B;
+    auto R_a = T->multiply(r_a);
     auto K_a = (P_b * r_a).project();
     std::vector<ecc::element<int>> M_a;
     for (size_t i = 0; i < 3; ++i)
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <eccrypto.h>
@@ -22,26 +23,30 @@ int main(int argc, char** argv) {
     const auto mesFil = string(argv[2]);
     const auto cipFil = string(argv[3]);
 
-    const auto F = make_shared<PrimeField<V>>
-        (V("1461501637330902918203684832716283019653785059327"));
+    static constexpr V a = -3_bi;
+    static constexpr V b =
+        163235791306168110546604919403271579530548345413_bi;
+    static constexpr V B_x =
+        425826231723888350446541592701409065913635568770_bi;
+    static constexpr V B_y =
+        203520114162904107873991457957346892027982641970_bi;
+    static constexpr V l =
+        1461501637330902918203687197606826779884643492439_bi;
+
+    const auto F = make_shared<SpecialPrimeField<V, secp160r1>>();
     const auto fe = make_factory<element<V>>(F.get());
-    const auto E = make_shared<EllipticCurve<V>>(
-        F.get(),
-        fe(V(-3)),
-        fe(V("163235791306168110546604919403271579530548345413"))
-    );
+    const auto E = make_shared<EllipticCurve<V>>(F.get(), fe(a), fe(b));
 
     const auto rp = make_factory<rational_point<V>>(E.get());
-    const auto B = rp(
-        fe(V("425826231723888350446541592701409065913635568770")),
-        fe(V("203520114162904107873991457957346892027982641970"))
-    );
-    const auto G = make_shared<PrimeField<V>>
-        (V("1461501637330902918203687197606826779884643492439"));
+    const auto B = rp(fe(B_x), fe(B_y));
+    const auto G = make_shared<PrimeField<V>>(l);
     const auto ge = make_factory<element<V>>(G.get());
 
-    const auto ascTexToNums = [] (const string& ascTex) -> vector<V> {
-        vector<V> nums;
+    const auto ascTexToNums = [] (
+        const string& ascTex,
+        vector<uint8_t>*const heaBytes
+    ) -> vector<V> {
+        vector<uint8_t> bytes;
         concatinate(
             make_shared<InputProcess<int>>
                 (input_from(make_getter_from_range<int>(ascTex.begin(), ascTex.end()))),
@@ -49,23 +54,41 @@ int main(int argc, char** argv) {
                 (base64_decode()),
             make_shared<InputOutputProcess<bool, int>>
                 (bits_to_bytes()),
-            make_shared<InputOutputProcess<int, V>>
-                (bytes_to_numbers<V>()),
-            make_shared<OutputProcess<V>>
-                (output_to(make_putter_from_iterator<V>(back_inserter(nums))))
+            make_shared<OutputProcess<int>>
+                (output_to(make_putter_from_iterator<int>(back_inserter(bytes))))
         )->run();
+        const auto heaSiz = heaBytes->size();
+        if (
+            bytes.size() < heaSiz ||
+            (bytes.size() - heaSiz) % LOGICAL_SIZE_OF<V>() != 0
+        ) return vector<V>();
+        copy(bytes.begin(), bytes.begin() + heaSiz, heaBytes->begin());
+        vector<V> nums((bytes.size() - heaSiz) / LOGICAL_SIZE_OF<V>());
+        bytes_to_numbers<V>(bytes.data() + heaSiz, nums.size(), nums.data());
         return nums;
     };
-    const auto pubKey_nums = ascTexToNums(pubKey);
-    if (pubKey_nums.size() != 2) {
+    auto pubKey_heaBytes = vector<uint8_t>(1);
+    const auto pubKey_nums = ascTexToNums(pubKey, &pubKey_heaBytes);
+    rational_point<V> P;
+    if (
+        pubKey_nums.size() != 1 ||
+        (pubKey_heaBytes.at(0) != 2 && pubKey_heaBytes.at(0) != 3) ||
+        pubKey_nums.at(0) >= F->order() ||
+        !rational_point<V>::decompress(
+            E.get(),
+            fe(pubKey_nums.at(0)),
+            pubKey_heaBytes.at(0) == 3,
+            &P
+        )
+    ) {
         cerr << "error: invalid pubricKey" << endl;
         return 1;
     }
-    const auto P = rp(fe(pubKey_nums.at(0)), fe(pubKey_nums.at(1)));
 
     const auto rng = make_shared<RandomNumberGenerator<V>>();
     const auto r = ge(rng->getNumber(V(1), G->order() - V(1)));
     const auto R = (r * B).project();
+    const auto R_heaByte = R.is_odd() ? 3 : 2;
     const auto K = (r * P).project();
 
     ifstream mesIS(mesFil, ios::in | ios::binary);
@@ -92,12 +115,20 @@ int main(int argc, char** argv) {
                 const put_number<V>& putNum
             ) {
                 putNum(R.x().value());
-                putNum(R.y().value());
                 for (;;) putNum((fe(getNum()) + K.x()).value());
             }
         ),
         make_shared<InputOutputProcess<V, int>>
             (numbers_to_bytes<V>()),
+        make_shared<InputOutputProcess<int, int>>(
+            [&R_heaByte] (
+                const get_number<int>& getNum,
+                const put_number<int>& putNum
+            ) {
+                putNum(R_heaByte);
+                for (;;) putNum(getNum());
+            }
+        ),
         make_shared<OutputProcess<int>>
             (output_to(make_putter_from_ostream(cipOS)))
     )->run();
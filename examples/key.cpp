@@ -1,4 +1,5 @@
 #include <cstddef>
+#include <cstdint>
 #include <eccrypto.h>
 #include <iostream>
 #include <iterator>
@@ -17,35 +18,41 @@ int main(int argc, char** argv) {
         return 1;
     }
 
-    const auto F = make_shared<PrimeField<V>>
-        (V("1461501637330902918203684832716283019653785059327"));
+    static constexpr V a = -3_bi;
+    static constexpr V b =
+        163235791306168110546604919403271579530548345413_bi;
+    static constexpr V B_x =
+        425826231723888350446541592701409065913635568770_bi;
+    static constexpr V B_y =
+        203520114162904107873991457957346892027982641970_bi;
+    static constexpr V l =
+        1461501637330902918203687197606826779884643492439_bi;
+
+    const auto F = make_shared<SpecialPrimeField<V, secp160r1>>();
     const auto fe = make_factory<element<V>>(F.get());
-    const auto E = make_shared<EllipticCurve<V>>(
-        F.get(),
-        fe(V(-3)),
-        fe(V("163235791306168110546604919403271579530548345413"))
-    );
+    const auto E = make_shared<EllipticCurve<V>>(F.get(), fe(a), fe(b));
 
     const auto rp = make_factory<rational_point<V>>(E.get());
-    const auto B = rp(
-        fe(V("425826231723888350446541592701409065913635568770")),
-        fe(V("203520114162904107873991457957346892027982641970"))
-    );
-    const auto G = make_shared<PrimeField<V>>
-        (V("1461501637330902918203687197606826779884643492439"));
+    const auto B = rp(fe(B_x), fe(B_y));
+    const auto G = make_shared<PrimeField<V>>(l);
     const auto ge = make_factory<element<V>>(G.get());
 
     const auto rng = make_shared<RandomNumberGenerator<V>>();
     const auto d = ge(rng->getNumber(V(1), G->order() - V(1)));
     const auto P = (d * B).project();
 
-    const auto numsToAscTex = [] (const vector<V>& nums) -> string {
+    const auto numsToAscTex = [] (
+        const vector<uint8_t>& heaBytes,
+        const vector<V>& nums
+    ) -> string {
+        auto bytes = heaBytes;
+        bytes.resize(heaBytes.size() + LOGICAL_SIZE_OF<V>() * nums.size());
+        numbers_to_bytes<V>
+            (nums.data(), nums.size(), bytes.data() + heaBytes.size());
         string ascTex;
         concatinate(
-            make_shared<InputProcess<V>>
-                (input_from(make_getter_from_range<V>(nums.begin(), nums.end()))),
-            make_shared<InputOutputProcess<V, int>>
-                (numbers_to_bytes<V>()),
+            make_shared<InputProcess<int>>
+                (input_from(make_getter_from_range<int>(bytes.begin(), bytes.end()))),
             make_shared<InputOutputProcess<int, bool>>
                 (bytes_to_bits()),
             make_shared<InputOutputProcess<bool, int>>
@@ -55,8 +62,11 @@ int main(int argc, char** argv) {
         )->run();
         return ascTex;
     };
-    cout << numsToAscTex(vector<V>({d.value()})) << endl;
-    cout << numsToAscTex(vector<V>({P.x().value(), P.y().value()})) << endl;
+    cout << numsToAscTex(vector<uint8_t>(), vector<V>({d.value()})) << endl;
+    cout << numsToAscTex(
+        vector<uint8_t>({uint8_t(P.is_odd() ? 3 : 2)}),
+        vector<V>({P.x().value()})
+    ) << endl;
 
     return 0;
 }
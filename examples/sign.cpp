@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <eccrypto.h>
@@ -21,26 +22,30 @@ int main(int argc, char** argv) {
     const auto priKey = string(argv[1]);
     const auto mesFil = string(argv[2]);
 
-    const auto F = make_shared<PrimeField<V>>
-        (V("1461501637330902918203684832716283019653785059327"));
+    static constexpr V a = -3_bi;
+    static constexpr V b =
+        163235791306168110546604919403271579530548345413_bi;
+    static constexpr V B_x =
+        425826231723888350446541592701409065913635568770_bi;
+    static constexpr V B_y =
+        203520114162904107873991457957346892027982641970_bi;
+    static constexpr V l =
+        1461501637330902918203687197606826779884643492439_bi;
+
+    const auto F = make_shared<SpecialPrimeField<V, secp160r1>>();
     const auto fe = make_factory<element<V>>(F.get());
-    const auto E = make_shared<EllipticCurve<V>>(
-        F.get(),
-        fe(V(-3)),
-        fe(V("163235791306168110546604919403271579530548345413"))
-    );
+    const auto E = make_shared<EllipticCurve<V>>(F.get(), fe(a), fe(b));
 
     const auto rp = make_factory<rational_point<V>>(E.get());
-    const auto B = rp(
-        fe(V("425826231723888350446541592701409065913635568770")),
-        fe(V("203520114162904107873991457957346892027982641970"))
-    );
-    const auto G = make_shared<PrimeField<V>>
-        (V("1461501637330902918203687197606826779884643492439"));
+    const auto B = rp(fe(B_x), fe(B_y));
+    const auto G = make_shared<PrimeField<V>>(l);
     const auto ge = make_factory<element<V>>(G.get());
 
-    const auto ascTexToNums = [] (const string& ascTex) -> vector<V> {
-        vector<V> nums;
+    const auto ascTexToNums = [] (
+        const string& ascTex,
+        vector<uint8_t>*const heaBytes
+    ) -> vector<V> {
+        vector<uint8_t> bytes;
         concatinate(
             make_shared<InputProcess<int>>
                 (input_from(make_getter_from_range<int>(ascTex.begin(), ascTex.end()))),
@@ -48,14 +53,21 @@ int main(int argc, char** argv) {
                 (base64_decode()),
             make_shared<InputOutputProcess<bool, int>>
                 (bits_to_bytes()),
-            make_shared<InputOutputProcess<int, V>>
-                (bytes_to_numbers<V>()),
-            make_shared<OutputProcess<V>>
-                (output_to(make_putter_from_iterator<V>(back_inserter(nums))))
+            make_shared<OutputProcess<int>>
+                (output_to(make_putter_from_iterator<int>(back_inserter(bytes))))
         )->run();
+        const auto heaSiz = heaBytes->size();
+        if (
+            bytes.size() < heaSiz ||
+            (bytes.size() - heaSiz) % LOGICAL_SIZE_OF<V>() != 0
+        ) return vector<V>();
+        copy(bytes.begin(), bytes.begin() + heaSiz, heaBytes->begin());
+        vector<V> nums((bytes.size() - heaSiz) / LOGICAL_SIZE_OF<V>());
+        bytes_to_numbers<V>(bytes.data() + heaSiz, nums.size(), nums.data());
         return nums;
     };
-    const auto priKey_nums = ascTexToNums(priKey);
+    auto priKey_heaBytes = vector<uint8_t>();
+    const auto priKey_nums = ascTexToNums(priKey, &priKey_heaBytes);
     if (priKey_nums.size() != 1) {
         cerr << "error: invalid privateKey" << endl;
         return 1;
@@ -97,13 +109,18 @@ int main(int argc, char** argv) {
         u = (h + ge(U.x()) * d) / r;
     } while (!u);
 
-    const auto numsToAscTex = [] (const vector<V>& nums) -> string {
+    const auto numsToAscTex = [] (
+        const vector<uint8_t>& heaBytes,
+        const vector<V>& nums
+    ) -> string {
+        auto bytes = heaBytes;
+        bytes.resize(heaBytes.size() + LOGICAL_SIZE_OF<V>() * nums.size());
+        numbers_to_bytes<V>
+            (nums.data(), nums.size(), bytes.data() + heaBytes.size());
         string ascTex;
         concatinate(
-            make_shared<InputProcess<V>>
-                (input_from(make_getter_from_range<V>(nums.begin(), nums.end()))),
-            make_shared<InputOutputProcess<V, int>>
-                (numbers_to_bytes<V>()),
+            make_shared<InputProcess<int>>
+                (input_from(make_getter_from_range<int>(bytes.begin(), bytes.end()))),
             make_shared<InputOutputProcess<int, bool>>
                 (bytes_to_bits()),
             make_shared<InputOutputProcess<bool, int>>
@@ -113,7 +130,10 @@ int main(int argc, char** argv) {
         )->run();
         return ascTex;
     };
-    cout << numsToAscTex(vector<V>({U.x().value(), U.y().value(), u.value()}));
+    cout << numsToAscTex(
+        vector<uint8_t>({uint8_t(U.is_odd() ? 3 : 2)}),
+        vector<V>({U.x().value(), u.value()})
+    );
 
     return 0;
 }
@@ -0,0 +1,702 @@
+#include "eccrypto.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+namespace ecc {
+    namespace {
+        inline void montgomery_multiply_body(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const uint64_t*const ord,
+            const size_t& len,
+            const uint64_t& negInv,
+            uint64_t*const res
+        ) {
+            for (size_t i = 0; i < len + 2; ++i) res[i] = 0;
+            for (size_t i = 0; i < len; ++i) {
+                uint64_t car = 0, hig = 0;
+                for (size_t j = 0; j < len; ++j)
+                    res[j] = multiply_with_carry(lhs[i], rhs[j], res[j], &car);
+                res[len] = add_with_carry(res[len], car, &hig);
+                res[len + 1] = hig;
+                const uint64_t m = res[0] * negInv;
+                car = 0;
+                multiply_with_carry(m, ord[0], res[0], &car);
+                for (size_t j = 1; j < len; ++j)
+                    res[j - 1] = multiply_with_carry(m, ord[j], res[j], &car);
+                hig = 0;
+                res[len - 1] = add_with_carry(res[len], car, &hig);
+                res[len] = res[len + 1] + hig;
+            }
+        }
+
+        inline void montgomery_reduce_body(
+            uint64_t*const num,
+            const uint64_t*const ord,
+            const size_t& len,
+            const uint64_t& negInv
+        ) {
+            for (size_t i = 0; i < len; ++i) {
+                const uint64_t m = num[i] * negInv;
+                uint64_t car = 0;
+                for (size_t j = 0; j < len; ++j)
+                    num[i + j] =
+                        multiply_with_carry(m, ord[j], num[i + j], &car);
+                for (size_t j = i + len; car && j <= 2 * len; ++j) {
+                    uint64_t sum = 0;
+                    num[j] = add_with_carry(num[j], car, &sum);
+                    car = sum;
+                }
+            }
+        }
+
+        const field_kernels GENERIC_KERNELS = {
+            "generic",
+            multiply_fields_generic,
+            square_fields_generic,
+            montgomery_multiply_generic,
+            montgomery_reduce_generic
+        };
+
+#if defined(__x86_64__) && defined(__GNUC__)
+        const field_kernels BMI2_ADX_KERNELS = {
+            "bmi2_adx",
+            multiply_fields_bmi2_adx,
+            square_fields_bmi2_adx,
+            montgomery_multiply_bmi2_adx,
+            montgomery_reduce_bmi2_adx
+        };
+#endif
+
+        template <typename T> struct unaligned {
+            using type = T;
+        };
+
+        template <typename T> inline const typename unaligned<T>::type&
+            load_lanes(const uint64_t*const ptr)
+        {
+            return *reinterpret_cast<const typename unaligned<T>::type*>(ptr);
+        }
+
+        template <typename T> inline void store_lanes
+            (uint64_t*const ptr, const typename unaligned<T>::type& val)
+        {
+            *reinterpret_cast<typename unaligned<T>::type*>(ptr) = val;
+        }
+
+        inline void multiply_digits
+            (uint64_t*const pro, const uint64_t& lhs, const uint64_t& rhs)
+        {
+            *pro = lhs * rhs;
+        }
+
+#if defined(__x86_64__) && defined(__GNUC__)
+        typedef uint64_t avx2_lanes __attribute__((vector_size(32)));
+
+        template <> struct unaligned<avx2_lanes> {
+            typedef uint64_t type
+                __attribute__((vector_size(32), aligned(8), may_alias));
+        };
+
+        __attribute__((target("avx2"))) inline void multiply_digits(
+            avx2_lanes*const pro,
+            const unaligned<avx2_lanes>::type& lhs,
+            const unaligned<avx2_lanes>::type& rhs
+        ) {
+            *pro = avx2_lanes(_mm256_mul_epu32(__m256i(lhs), __m256i(rhs)));
+        }
+#endif
+
+        template <typename T> void add_lanes(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const size_t& len,
+            const size_t& lan,
+            const size_t& beg,
+            uint64_t*const res
+        ) {
+            constexpr size_t W = sizeof(T) / sizeof(uint64_t);
+            for (size_t k = beg; k + W <= lan; k += W) {
+                T car = T{};
+                for (size_t i = 0; i < len; ++i) {
+                    const size_t j = i * lan + k;
+                    const T sum = load_lanes<T>(lhs + j) +
+                        load_lanes<T>(rhs + j) + car;
+                    store_lanes<T>(res + j, sum & 0xffffffff);
+                    car = sum >> 32;
+                }
+            }
+        }
+
+        template <typename T> void subtract_lanes(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const size_t& len,
+            const size_t& lan,
+            const size_t& beg,
+            uint64_t*const res
+        ) {
+            constexpr size_t W = sizeof(T) / sizeof(uint64_t);
+            for (size_t k = beg; k + W <= lan; k += W) {
+                T bor = T{};
+                for (size_t i = 0; i < len; ++i) {
+                    const size_t j = i * lan + k;
+                    const T dif = load_lanes<T>(lhs + j) -
+                        load_lanes<T>(rhs + j) - bor;
+                    store_lanes<T>(res + j, dif & 0xffffffff);
+                    bor = dif >> 63;
+                }
+            }
+        }
+
+        template <typename T> void multiply_lanes(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const size_t& len,
+            const size_t& lan,
+            const size_t& beg,
+            uint64_t*const res
+        ) {
+            constexpr size_t W = sizeof(T) / sizeof(uint64_t);
+            for (size_t k = beg; k + W <= lan; k += W) {
+                for (size_t i = 0; i < len; ++i)
+                    store_lanes<T>(res + i * lan + k, T{});
+                for (size_t i = 0; i < len; ++i) {
+                    const T l = load_lanes<T>(lhs + i * lan + k);
+                    T car = T{};
+                    for (size_t j = 0; i + j < len; ++j) {
+                        const size_t ind = (i + j) * lan + k;
+                        T pro;
+                        multiply_digits
+                            (&pro, l, load_lanes<T>(rhs + j * lan + k));
+                        const T sum = load_lanes<T>(res + ind) + pro + car;
+                        store_lanes<T>(res + ind, sum & 0xffffffff);
+                        car = sum >> 32;
+                    }
+                }
+            }
+        }
+
+        template <typename T> void subtract_order_lanes(
+            uint64_t*const num,
+            const uint64_t*const ord,
+            const size_t& len,
+            const size_t& str,
+            const T& top
+        ) {
+            T bor = T{};
+            for (size_t i = 0; i < len; ++i)
+                bor = (load_lanes<T>(num + i * str) - ord[i] - bor) >> 63;
+            const T mas = T{} - (top | (bor ^ 1));
+            bor = T{};
+            for (size_t i = 0; i < len; ++i) {
+                const T dif = load_lanes<T>(num + i * str) - (mas & ord[i]) -
+                    bor;
+                store_lanes<T>(num + i * str, dif & 0xffffffff);
+                bor = dif >> 63;
+            }
+        }
+
+        template <typename T> void add_modulo_lanes(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const uint64_t*const ord,
+            const size_t& len,
+            const size_t& lan,
+            const size_t& beg,
+            uint64_t*const res
+        ) {
+            constexpr size_t W = sizeof(T) / sizeof(uint64_t);
+            for (size_t k = beg; k + W <= lan; k += W) {
+                T car = T{};
+                for (size_t i = 0; i < len; ++i) {
+                    const size_t j = i * lan + k;
+                    const T sum = load_lanes<T>(lhs + j) +
+                        load_lanes<T>(rhs + j) + car;
+                    store_lanes<T>(res + j, sum & 0xffffffff);
+                    car = sum >> 32;
+                }
+                subtract_order_lanes(res + k, ord, len, lan, car);
+            }
+        }
+
+        template <typename T> void subtract_modulo_lanes(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const uint64_t*const ord,
+            const size_t& len,
+            const size_t& lan,
+            const size_t& beg,
+            uint64_t*const res
+        ) {
+            constexpr size_t W = sizeof(T) / sizeof(uint64_t);
+            for (size_t k = beg; k + W <= lan; k += W) {
+                T bor = T{};
+                for (size_t i = 0; i < len; ++i) {
+                    const size_t j = i * lan + k;
+                    const T dif = load_lanes<T>(lhs + j) -
+                        load_lanes<T>(rhs + j) - bor;
+                    store_lanes<T>(res + j, dif & 0xffffffff);
+                    bor = dif >> 63;
+                }
+                const T mas = T{} - bor;
+                T car = T{};
+                for (size_t i = 0; i < len; ++i) {
+                    const size_t j = i * lan + k;
+                    const T sum = load_lanes<T>(res + j) + (mas & ord[i]) + car;
+                    store_lanes<T>(res + j, sum & 0xffffffff);
+                    car = sum >> 32;
+                }
+            }
+        }
+
+        template <typename T> void montgomery_multiply_lanes(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const uint64_t*const ord,
+            const size_t& len,
+            const uint64_t& negInv,
+            const size_t& lan,
+            const size_t& beg,
+            uint64_t*const res,
+            uint64_t*const tmp
+        ) {
+            constexpr size_t W = sizeof(T) / sizeof(uint64_t);
+            const T inv = T{} + negInv;
+            for (size_t k = beg; k + W <= lan; k += W) {
+                for (size_t i = 0; i < len + 2; ++i)
+                    store_lanes<T>(tmp + i * W, T{});
+                for (size_t i = 0; i < len; ++i) {
+                    const T l = load_lanes<T>(lhs + i * lan + k);
+                    T car = T{}, pro, sum;
+                    for (size_t j = 0; j < len; ++j) {
+                        multiply_digits
+                            (&pro, l, load_lanes<T>(rhs + j * lan + k));
+                        sum = load_lanes<T>(tmp + j * W) + pro + car;
+                        store_lanes<T>(tmp + j * W, sum & 0xffffffff);
+                        car = sum >> 32;
+                    }
+                    sum = load_lanes<T>(tmp + len * W) + car;
+                    store_lanes<T>(tmp + len * W, sum & 0xffffffff);
+                    store_lanes<T>(tmp + (len + 1) * W, sum >> 32);
+                    T m;
+                    multiply_digits(&m, load_lanes<T>(tmp), inv);
+                    m &= 0xffffffff;
+                    multiply_digits(&pro, m, T{} + ord[0]);
+                    car = (load_lanes<T>(tmp) + pro) >> 32;
+                    for (size_t j = 1; j < len; ++j) {
+                        multiply_digits(&pro, m, T{} + ord[j]);
+                        sum = load_lanes<T>(tmp + j * W) + pro + car;
+                        store_lanes<T>(tmp + (j - 1) * W, sum & 0xffffffff);
+                        car = sum >> 32;
+                    }
+                    sum = load_lanes<T>(tmp + len * W) + car;
+                    store_lanes<T>(tmp + (len - 1) * W, sum & 0xffffffff);
+                    store_lanes<T>(tmp + len * W,
+                        load_lanes<T>(tmp + (len + 1) * W) + (sum >> 32));
+                }
+                const T top = load_lanes<T>(tmp + len * W);
+                subtract_order_lanes(tmp, ord, len, W, top);
+                for (size_t i = 0; i < len; ++i)
+                    store_lanes<T>
+                        (res + i * lan + k, load_lanes<T>(tmp + i * W));
+            }
+        }
+
+        void add_generic(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const size_t& len,
+            const size_t& lan,
+            uint64_t*const res
+        ) {
+            add_lanes<uint64_t>(lhs, rhs, len, lan, 0, res);
+        }
+
+        void subtract_generic(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const size_t& len,
+            const size_t& lan,
+            uint64_t*const res
+        ) {
+            subtract_lanes<uint64_t>(lhs, rhs, len, lan, 0, res);
+        }
+
+        void multiply_generic(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const size_t& len,
+            const size_t& lan,
+            uint64_t*const res
+        ) {
+            multiply_lanes<uint64_t>(lhs, rhs, len, lan, 0, res);
+        }
+
+        void add_modulo_generic(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const uint64_t*const ord,
+            const size_t& len,
+            const size_t& lan,
+            uint64_t*const res
+        ) {
+            add_modulo_lanes<uint64_t>(lhs, rhs, ord, len, lan, 0, res);
+        }
+
+        void subtract_modulo_generic(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const uint64_t*const ord,
+            const size_t& len,
+            const size_t& lan,
+            uint64_t*const res
+        ) {
+            subtract_modulo_lanes<uint64_t>(lhs, rhs, ord, len, lan, 0, res);
+        }
+
+        const batch_kernels GENERIC_BATCH_KERNELS = {
+            "generic",
+            add_generic,
+            subtract_generic,
+            multiply_generic,
+            add_modulo_generic,
+            subtract_modulo_generic,
+            nullptr
+        };
+
+#if defined(__x86_64__) && defined(__GNUC__)
+        __attribute__((target("avx2"), flatten)) void add_avx2(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const size_t& len,
+            const size_t& lan,
+            uint64_t*const res
+        ) {
+            add_lanes<avx2_lanes>(lhs, rhs, len, lan, 0, res);
+            add_lanes<uint64_t>(lhs, rhs, len, lan, lan & ~size_t(3), res);
+        }
+
+        __attribute__((target("avx2"), flatten)) void subtract_avx2(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const size_t& len,
+            const size_t& lan,
+            uint64_t*const res
+        ) {
+            subtract_lanes<avx2_lanes>(lhs, rhs, len, lan, 0, res);
+            subtract_lanes<uint64_t>
+                (lhs, rhs, len, lan, lan & ~size_t(3), res);
+        }
+
+        __attribute__((target("avx2"), flatten)) void multiply_avx2(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const size_t& len,
+            const size_t& lan,
+            uint64_t*const res
+        ) {
+            multiply_lanes<avx2_lanes>(lhs, rhs, len, lan, 0, res);
+            multiply_lanes<uint64_t>
+                (lhs, rhs, len, lan, lan & ~size_t(3), res);
+        }
+
+        __attribute__((target("avx2"), flatten)) void add_modulo_avx2(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const uint64_t*const ord,
+            const size_t& len,
+            const size_t& lan,
+            uint64_t*const res
+        ) {
+            add_modulo_lanes<avx2_lanes>(lhs, rhs, ord, len, lan, 0, res);
+            add_modulo_lanes<uint64_t>
+                (lhs, rhs, ord, len, lan, lan & ~size_t(3), res);
+        }
+
+        __attribute__((target("avx2"), flatten)) void subtract_modulo_avx2(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const uint64_t*const ord,
+            const size_t& len,
+            const size_t& lan,
+            uint64_t*const res
+        ) {
+            subtract_modulo_lanes<avx2_lanes>
+                (lhs, rhs, ord, len, lan, 0, res);
+            subtract_modulo_lanes<uint64_t>
+                (lhs, rhs, ord, len, lan, lan & ~size_t(3), res);
+        }
+
+        __attribute__((target("avx2"), flatten))
+            void montgomery_multiply_batch_avx2(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const uint64_t*const ord,
+            const size_t& len,
+            const uint64_t& negInv,
+            const size_t& lan,
+            uint64_t*const res,
+            uint64_t*const tmp
+        ) {
+            montgomery_multiply_lanes<avx2_lanes>
+                (lhs, rhs, ord, len, negInv, lan, 0, res, tmp);
+            montgomery_multiply_lanes<uint64_t>
+                (lhs, rhs, ord, len, negInv, lan, lan & ~size_t(3), res, tmp);
+        }
+
+        const batch_kernels AVX2_BATCH_KERNELS = {
+            "avx2",
+            add_avx2,
+            subtract_avx2,
+            multiply_avx2,
+            add_modulo_avx2,
+            subtract_modulo_avx2,
+            montgomery_multiply_batch_avx2
+        };
+#endif
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        constexpr bool BIG_ENDIAN_ON_HOST = true;
+#else
+        constexpr bool BIG_ENDIAN_ON_HOST = false;
+#endif
+
+        inline uint64_t swap_bytes(const uint64_t& fie) {
+#if defined(__GNUC__)
+            return __builtin_bswap64(fie);
+#else
+            uint64_t swa = 0;
+            for (size_t i = 0; i < sizeof(uint64_t); ++i)
+                swa = (swa << 8) | ((fie >> (8 * i)) & 0xff);
+            return swa;
+#endif
+        }
+
+        const field_kernels* current_kernels = &GENERIC_KERNELS;
+
+        const batch_kernels* current_batch_kernels = &GENERIC_BATCH_KERNELS;
+
+        const initializer KERNELS_INITIALIZER([] {
+            select_kernels(false);
+        });
+    }
+
+    void bytes_to_fields(
+        uint64_t*const fies,
+        const size_t& len,
+        const uint8_t*const byts,
+        const size_t& siz,
+        const bool& ord
+    ) {
+        constexpr size_t Z = sizeof(uint64_t);
+        const size_t lenOfByt = std::min(siz, Z * len), quo = lenOfByt / Z;
+        std::memset(fies, 0, Z * len);
+        for (size_t i = 0; i < quo; ++i) {
+            uint64_t fie;
+            std::memcpy(&fie, ord ? byts + siz - Z * (i + 1) : byts + Z * i, Z);
+            fies[i] = ord == BIG_ENDIAN_ON_HOST ? fie : swap_bytes(fie);
+        }
+        for (size_t j = Z * quo; j < lenOfByt; ++j)
+            fies[quo] |=
+                uint64_t(ord ? byts[siz - j - 1] : byts[j]) << (8 * (j % Z));
+    }
+
+    void fields_to_bytes(
+        const uint64_t*const fies,
+        const size_t& len,
+        uint8_t*const byts,
+        const size_t& siz,
+        const bool& ord
+    ) {
+        constexpr size_t Z = sizeof(uint64_t);
+        const size_t lenOfByt = std::min(siz, Z * len), quo = lenOfByt / Z;
+        for (size_t i = 0; i < quo; ++i) {
+            const uint64_t fie =
+                ord == BIG_ENDIAN_ON_HOST ? fies[i] : swap_bytes(fies[i]);
+            std::memcpy(ord ? byts + siz - Z * (i + 1) : byts + Z * i, &fie, Z);
+        }
+        for (size_t j = Z * quo; j < siz; ++j) {
+            const uint8_t byt =
+                j < lenOfByt ? uint8_t(fies[quo] >> (8 * (j % Z))) : 0;
+            if (ord) byts[siz - j - 1] = byt;
+            else byts[j] = byt;
+        }
+    }
+
+    const field_kernels& kernels() {
+        return *current_kernels;
+    }
+
+    const batch_kernels& kernels_for_batch() {
+        return *current_batch_kernels;
+    }
+
+    bool supports_bmi2_adx() {
+#if defined(__x86_64__) && defined(__GNUC__)
+        unsigned int eax, ebx, ecx, edx;
+        if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) return false;
+        return (ebx & bit_BMI2) && (ebx & bit_ADX);
+#else
+        return false;
+#endif
+    }
+
+    bool supports_avx2() {
+#if defined(__x86_64__) && defined(__GNUC__)
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+#else
+        return false;
+#endif
+    }
+
+    const field_kernels& select_kernels(const bool& gen) {
+        current_kernels = &GENERIC_KERNELS;
+        current_batch_kernels = &GENERIC_BATCH_KERNELS;
+#if defined(__x86_64__) && defined(__GNUC__)
+        if (!gen && supports_bmi2_adx()) current_kernels = &BMI2_ADX_KERNELS;
+        if (!gen && supports_avx2())
+            current_batch_kernels = &AVX2_BATCH_KERNELS;
+#endif
+        return *current_kernels;
+    }
+
+    void montgomery_multiply_generic(
+        const uint64_t*const lhs,
+        const uint64_t*const rhs,
+        const uint64_t*const ord,
+        const size_t& len,
+        const uint64_t& negInv,
+        uint64_t*const res
+    ) {
+        montgomery_multiply_body(lhs, rhs, ord, len, negInv, res);
+    }
+
+    void montgomery_reduce_generic(
+        uint64_t*const num,
+        const uint64_t*const ord,
+        const size_t& len,
+        const uint64_t& negInv
+    ) {
+        montgomery_reduce_body(num, ord, len, negInv);
+    }
+
+    void multiply_fields_generic(
+        const uint64_t*const lhs,
+        const uint64_t*const rhs,
+        const size_t& len,
+        uint64_t*const pro
+    ) {
+        multiply_fields(lhs, rhs, len, pro);
+    }
+
+    void square_fields_generic
+        (const uint64_t*const num, const size_t& len, uint64_t*const pro)
+    {
+        square_fields(num, len, pro);
+    }
+
+#if defined(__x86_64__) && defined(__GNUC__)
+    namespace {
+        inline uint64_t multiply_add_row(
+            uint64_t*const acc,
+            const uint64_t& lhs,
+            const uint64_t*const rhs,
+            const size_t& len
+        ) {
+            uint64_t* ite = acc;
+            const uint64_t* rit = rhs;
+            size_t cnt = len;
+            uint64_t car, low, hig;
+            __asm__ __volatile__ (
+                "xorl %k[car], %k[car]\n\t"
+                "1:\n\t"
+                "jrcxz 2f\n\t"
+                "mulx (%[rit]), %[low], %[hig]\n\t"
+                "adcx (%[ite]), %[low]\n\t"
+                "adox 8(%[ite]), %[hig]\n\t"
+                "movq %[low], (%[ite])\n\t"
+                "movq %[hig], 8(%[ite])\n\t"
+                "leaq 8(%[rit]), %[rit]\n\t"
+                "leaq 8(%[ite]), %[ite]\n\t"
+                "leaq -1(%[cnt]), %[cnt]\n\t"
+                "jmp 1b\n\t"
+                "2:\n\t"
+                "movq (%[ite]), %[low]\n\t"
+                "adcx %[car], %[low]\n\t"
+                "movq %[low], (%[ite])\n\t"
+                "movl $0, %k[hig]\n\t"
+                "adcx %[car], %[hig]\n\t"
+                "adox %[car], %[hig]\n\t"
+                : [ite] "+r" (ite), [rit] "+r" (rit), [cnt] "+c" (cnt),
+                    [car] "=&r" (car), [low] "=&r" (low), [hig] "=&r" (hig)
+                : "d" (lhs)
+                : "cc", "memory"
+            );
+            return hig;
+        }
+    }
+
+    __attribute__((target("bmi2,adx")))
+        void montgomery_multiply_bmi2_adx(
+        const uint64_t*const lhs,
+        const uint64_t*const rhs,
+        const uint64_t*const ord,
+        const size_t& len,
+        const uint64_t& negInv,
+        uint64_t*const res
+    ) {
+        for (size_t i = 0; i < len + 2; ++i) res[i] = 0;
+        for (size_t i = 0; i < len; ++i) {
+            res[len + 1] += multiply_add_row(res, lhs[i], rhs, len);
+            res[len + 1] += multiply_add_row(res, res[0] * negInv, ord, len);
+            for (size_t j = 0; j <= len; ++j) res[j] = res[j + 1];
+            res[len + 1] = 0;
+        }
+    }
+
+    __attribute__((target("bmi2,adx")))
+        void montgomery_reduce_bmi2_adx(
+        uint64_t*const num,
+        const uint64_t*const ord,
+        const size_t& len,
+        const uint64_t& negInv
+    ) {
+        for (size_t i = 0; i < len; ++i) {
+            uint64_t car =
+                multiply_add_row(num + i, num[i] * negInv, ord, len);
+            for (size_t j = i + len + 1; car && j <= 2 * len; ++j) {
+                uint64_t sum = 0;
+                num[j] = add_with_carry(num[j], car, &sum);
+                car = sum;
+            }
+        }
+    }
+
+    __attribute__((target("bmi2,adx")))
+        void multiply_fields_bmi2_adx(
+        const uint64_t*const lhs,
+        const uint64_t*const rhs,
+        const size_t& len,
+        uint64_t*const pro
+    ) {
+        for (size_t i = 0; i < 2 * len; ++i) pro[i] = 0;
+        for (size_t i = 0; i < len; ++i)
+            multiply_add_row(pro + i, lhs[i], rhs, len);
+    }
+
+    __attribute__((target("bmi2,adx"), flatten))
+        void square_fields_bmi2_adx
+        (const uint64_t*const num, const size_t& len, uint64_t*const pro)
+    {
+        square_fields(num, len, pro);
+    }
+#endif
+}
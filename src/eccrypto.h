@@ -827,11 +827,11 @@
  * c & d: 1111111111111111
  * c | d: 7777777777777777
  * c ^ d: 6666666666666666
- * ~c: ffffffffffffffffffffcccccccccccccccc
+ * ~c: ffffffffffffffffffffffffffffffffcccccccccccccccc
  * e << 2: 32
  * e >> 2: 2
- * f << 2: ffffffffffe4
- * f >> 2: fffffffffffe
+ * f << 2: ffffffffffffffe4
+ * f >> 2: fffffffffffffffe
  * e == e: 1
  * e == f: 0
  * e != f: 1
@@ -842,16 +842,16 @@
  * e >= f: 1
  * \endcode
  * \section pbisaccess アクセス
- * 整数のデータは32ビットごとに分割され、「フィールド」の配列に格納さ<!--
+ * 整数のデータは64ビットごとに分割され、「フィールド」の配列に格納さ<!--
  * -->れます。\n
  * \code
- * auto a = ecc::big_int<4, true>(-3);
- * for (size_t i = 0; i < ecc::big_int<4, true>::NUMBER_OF_FIELDS; ++i)
+ * auto a = ecc::big_int<8, true>(-3);
+ * for (size_t i = 0; i < ecc::big_int<8, true>::NUMBER_OF_FIELDS; ++i)
  *     std::cout << std::hex << a[i] << " ";
  * \endcode
  * 実行した結果を示します。\n
  * \code
- * fffffffd ffffffff
+ * fffffffffffffffd ffffffffffffffff
  * \endcode
  * `ecc::big_int::NUMBER_OF_FIELDS`定数にフィールドの数が定義されます。\n
  * 各フィールドには`ecc::big_int::operator[]`演算子でアクセスできます。\n
@@ -877,6 +877,13 @@
  * 160ビット長なら`ecc::big_int<20>`、256ビット長なら<!--
  * -->`ecc::big_int<32>`を使ってください。\n
  * \n
+ * `ecc::PrimeField`の代わりに`ecc::MontgomeryField`を使うと素体の元の<!--
+ * -->乗算が速くなります。\n
+ * \code
+ * auto F = std::make_shared<ecc::MontgomeryField<ecc::big_int<20>>>
+ *     (ecc::big_int<20>("1461501637330902918203684832716283019653785059327"));
+ * \endcode
+ * \n
  * \ref pstools "次のページへ"
  */
 /*!\page pstools サンプルツール
@@ -898,12 +905,13 @@
  * \n
  * `key`は鍵を生成します。\n
  * 1行目に秘密鍵、2行目に公開鍵を表示します。\n
+ * 公開鍵は点のx座標とy座標の偶奇による圧縮した形式です。\n
  * \n
  * 実行した例を示します。\n
  * \code
  * $ ./key
  * QLRqG8K4cy/g106ocTQKTIF23bk=
- * Mfx+uhX0C+U0MH7CfP0UTe0amwD5XavdkAVzCXkEWf9l+N6YR3okUw==
+ * AzH8froV9AvlNDB+wnz9FE3tGpsA
  * \endcode
  * \section pstsencrypt encrypt
  * `usage: encrypt publicKey messageFile cipherFile`\n
@@ -915,7 +923,7 @@
  * \code
  * $ echo いろはにほへと > message.txt
  *
- * $ ./encrypt Mfx+uhX0C+U0MH7CfP0UTe0amwD5XavdkAVzCXkEWf9l+N6YR3okUw== message.txt message.txt.cip
+ * $ ./encrypt AzH8froV9AvlNDB+wnz9FE3tGpsA message.txt message.txt.cip
  * \endcode
  * \section pstsdecrypt decrypt
  * `usage: decrypt privateKey cipherFile messageFile`\n
@@ -939,7 +947,7 @@
  * 実行した例を示します。\n
  * \code
  * $ ./sign QLRqG8K4cy/g106ocTQKTIF23bk= message.txt
- * qHqZOT7qPHuqCL+9gUCaKiRSzheR5Oa3DcT6Dg2WRvsGAvtGF3G1wELn9F+qS0CFrBy4NgOShriILXOt
+ * A22TscAljgbGwo2eYN1bptNLuEpq0NFe3IJj0fk/b8cMBHEVIwaSw3Y=
  * \endcode
  * \section pstsverify verify
  * `usage: verify publicKey signature messageFile`\n
@@ -950,7 +958,7 @@
  * \n
  * 実行した例を示します。\n
  * \code
- * $ ./verify Mfx+uhX0C+U0MH7CfP0UTe0amwD5XavdkAVzCXkEWf9l+N6YR3okUw== qHqZOT7qPHuqCL+9gUCaKiRSzheR5Oa3DcT6Dg2WRvsGAvtGF3G1wELn9F+qS0CFrBy4NgOShriILXOt message.txt
+ * $ ./verify AzH8froV9AvlNDB+wnz9FE3tGpsA A22TscAljgbGwo2eYN1bptNLuEpq0NFe3IJj0fk/b8cMBHEVIwaSw3Y= message.txt
  * OK
  * \endcode
  * <a href="modules.html"><b>モジュールへ</b></a>\n
@@ -973,11 +981,25 @@
 #include <queue>
 #include <random>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <thread>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#ifndef ECCRYPTO_BIG_INT_ALIGNMENT
+/*!\brief `ecc::big_int`のアライメント(バイト長)。
+ *
+ * インクルードする前に定義すれば変更できる。\n
+ * 例えば`64`と定義すれば、配列の要素がキャッシュラインをまたがなく<!--
+ * -->なる。\n
+ * 既定値は`8`。\n
+ * \warning 2のべき乗で、`8`以上でなければならない。\n
+ */
+#define ECCRYPTO_BIG_INT_ALIGNMENT 8
+#endif
+
 /*!\brief 楕円曲線暗号を用いた暗号システムの構築を支援する。
  *
  * \section neccclasses クラス
@@ -1014,20 +1036,33 @@ namespace ecc {
     template <typename O> class AbstractInputProcess;
     template <typename I> class AbstractOutputProcess;
     template <typename V> class EllipticCurve;
+    template <typename V> class FixedBaseTable;
     template <typename O> class InputProcess;
     template <typename I, typename O> class InputOutputProcess;
     template <typename V> class Joint;
+    template <typename V> class MontgomeryField;
     template <typename I> class OutputProcess;
     template <typename V> class PrimeField;
     class Process;
     class PseudoRandomBitGenerator;
     template <typename V, class RBG> class RandomNumberGenerator;
-    template <size_t S, bool C> class big_int;
+    template <typename V, class K> class SpecialPrimeField;
+    template <typename V, class K> class UnsaturatedField;
+    struct addition_chain_step;
+    template <size_t S, bool C, bool W, bool U> class big_int;
+    template <typename N, size_t L> class big_int_batch;
+    template <char... CS> class big_int_literal;
     template <typename V> class element;
+    template <typename V> class element_acc;
+    template <typename V, size_t L> class element_batch;
     class eof_exception;
     template <typename V, class P> class factory;
+    template <typename V, class K> class fp;
+    template <class K, typename = void> struct has_square_root_chain;
     class initializer;
+    template <typename V> struct narrow;
     template <typename V> class rational_point;
+    template <typename V> struct wide;
 
     /*!\brief ビットを入力する関数。
      * \return 入力したビット。\n
@@ -1158,7 +1193,8 @@ namespace ecc {
      * -->まれる。\n
      * これらのクラスは以下のような階層関係をなし、下位のオブジェクト<!--
      * -->は上位のオブジェクトに依存する。\n
-     * - `ecc::PrimeField`
+     * - `ecc::PrimeField`(`ecc::MontgomeryField`、<!--
+     *   -->`ecc::SpecialPrimeField`、`ecc::UnsaturatedField`)
      *   + `ecc::element`
      *   + `ecc::EllipticCurve`
      *     + `ecc::rational_point`
@@ -1188,22 +1224,744 @@ namespace ecc {
      *
      * 位数を保持する。\n
      * `ecc::element`と`ecc::EllipticCurve`の生成源である。\n
+     * \n
+     * `ecc::element`の値は素体が定める内部表現で保持され、演算は素体<!--
+     * -->に委ねられる。\n
+     * この素体の内部表現は位数を法とした剰余そのものである。\n
+     * 派生クラスは仮想関数をオーバーライドして内部表現と演算を変える<!--
+     * -->ことができる。\n
      * \tparam V 値の型(整数型)。\n
      */
     template <typename V> class PrimeField {
     public:
+        /*!\brief 内部表現の型。
+         *
+         * 位数未満の値しか保持しないので、`ecc::narrow`で定まる狭い型<!--
+         * -->を使う。\n
+         */
+        using residue = typename narrow<V>::type;
+
+        /*!\brief 積の和を保持する広い内部表現の型。
+         *
+         * `ecc::wide`で定まる広い型を使う。\n
+         */
+        using wide_residue = typename wide<V>::type;
+
         /*!\brief インスタンスを構築する。
          * \param ord 位数。\n
          * \warning `ord`は素数でなければならない。\n
          */
         PrimeField(const V& ord);
 
+        virtual ~PrimeField() = default;
+
         /*!\brief 位数を取得する。
          * \return 取得した位数。\n
          */
         V order();
+    protected:
+        residue ord_;
+        size_t acc_cap_;
+
+        /*!\brief 内部表現を累乗する。
+         *
+         * 2乗と乗算には素体の演算を使う。\n
+         * \param val 底の内部表現。\n
+         * \param exp 指数。`0`以上でなければならない。\n
+         * \return 計算した累乗の内部表現。\n
+         */
+        residue power(const residue& val, const V& exp);
+
+        /*!\brief 内部表現を加算連鎖で累乗する。
+         * \tparam N 加算連鎖の段の数。\n
+         * \param val 底の内部表現。\n
+         * \param cha 加算連鎖。\n
+         * \return 計算した累乗の内部表現。\n
+         */
+        template <size_t N> residue power
+            (const residue& val, const addition_chain_step (&cha)[N]);
+
+        /*!\brief 値を内部表現に変換する。
+         * \param val 値。\n
+         * \return 変換した内部表現。\n
+         */
+        virtual residue encode(const V& val);
+
+        /*!\brief 内部表現を値に変換する。
+         * \param val 内部表現。\n
+         * \return 変換した値。必ず`0`以上、位数未満となる。\n
+         */
+        virtual V decode(const residue& val);
+
+        /*!\brief 内部表現同士を乗算する。
+         *
+         * `ecc::multiply_wide`で広い型の積を計算し、<!--
+         * -->`ecc::reduce_wide`で剰余を計算する。\n
+         * \param lhs 被乗数の内部表現。\n
+         * \param rhs 乗数の内部表現。\n
+         * \return 計算した積の内部表現。\n
+         */
+        virtual residue multiply(const residue& lhs, const residue& rhs);
+
+        /*!\brief 内部表現を2乗する。
+         * \param val 内部表現。\n
+         * \return 計算した2乗の内部表現。\n
+         */
+        virtual residue square(const residue& val);
+
+        /*!\brief 内部表現の逆数を計算する。
+         * \param val 内部表現。\n
+         * \return 計算した逆数の内部表現。\n
+         * \warning `val`は非`0`でなければならない。\n
+         */
+        virtual residue invert(const residue& val);
+
+        /*!\brief 位数を法とした剰余を計算する。
+         *
+         * 内部表現同士の加算、減算の結果を位数未満に戻すときに使う。\n
+         * \param val 値。\n
+         * \return 計算した剰余。必ず`0`以上、位数未満となる。\n
+         */
+        virtual residue reduce(const residue& val);
+
+        /*!\brief 内部表現同士を加算する。
+         *
+         * 2倍は同じ内部表現同士を加算して計算する。\n
+         * 既定では`ecc::add_modulo`で位数を条件付きで引く。\n
+         * \param lhs 被加数の内部表現。\n
+         * \param rhs 加数の内部表現。\n
+         * \return 計算した和の内部表現。\n
+         */
+        virtual residue add(const residue& lhs, const residue& rhs);
+
+        /*!\brief 内部表現同士を減算する。
+         *
+         * 正負の反転は`0`の内部表現から減算して計算する。\n
+         * 既定では`ecc::subtract_modulo`で位数を条件付きで足す。\n
+         * \param lhs 被減数の内部表現。\n
+         * \param rhs 減数の内部表現。\n
+         * \return 計算した差の内部表現。\n
+         */
+        virtual residue subtract(const residue& lhs, const residue& rhs);
+
+        /*!\brief 内部表現同士が同じ値を表すかどうかを判定する。
+         *
+         * 既定では内部表現同士を直接比較する。\n
+         * \param lhs 左側の内部表現。\n
+         * \param rhs 右側の内部表現。\n
+         * \return 同じ値を表せば真、表さなければ偽。\n
+         */
+        virtual bool equal(const residue& lhs, const residue& rhs);
+
+        /*!\brief 内部表現を半分にする。
+         *
+         * 既定では`ecc::halve_modulo`で計算する。\n
+         * \param val 内部表現。\n
+         * \return 計算した内部表現。2倍すると`val`と同じ値を表す。\n
+         */
+        virtual residue halve(const residue& val);
+
+        /*!\brief 内部表現が平方剰余かどうかを判定する。
+         *
+         * 既定ではオイラーの規準で、\f$ a^{(p-1)/2} \f$が`1`かどうか<!--
+         * -->を調べる。指数は構築するときに計算しておく。\n
+         * \param val 内部表現。\n
+         * \return 平方剰余か`0`なら真、平方非剰余なら偽。\n
+         */
+        virtual bool is_square(const residue& val);
+
+        /*!\brief 内部表現の平方根を計算する。
+         *
+         * 既定では位数\f$ p \f$に応じて、\f$ p \equiv 3 \pmod 4 \f$<!--
+         * -->なら\f$ a^{(p+1)/4} \f$で、\f$ p \equiv 5 \pmod 8 \f$<!--
+         * -->ならアトキンの方法で、\f$ p \equiv 1 \pmod 8 \f$ならトネ<!--
+         * -->リ・シャンクスの方法で計算する。\n
+         * 指数と、トネリ・シャンクスの方法で使う平方非剰余の累乗は<!--
+         * -->構築するときに計算しておく。\n
+         * \param val 内部表現。\n
+         * \return 計算した平方根の内部表現。`val`が平方非剰余なら、<!--
+         * -->2乗しても`val`にならない値となる。\n
+         */
+        virtual residue square_root(const residue& val);
+
+        /*!\brief 内部表現を`ecc::element_batch`のレーンの形式に変換<!--
+         * -->する。
+         *
+         * レーンの形式は位数未満の剰余であり、レーンごとに<!--
+         * -->`ecc::add_modulo`、`ecc::subtract_modulo`で加減算できな<!--
+         * -->ければならない。\n
+         * 既定では内部表現をそのまま返す。\n
+         * \param val 内部表現。\n
+         * \return 変換したレーンの形式。\n
+         */
+        virtual residue to_lane(const residue& val);
+
+        /*!\brief `ecc::element_batch`のレーンの形式を内部表現に変換<!--
+         * -->する。
+         *
+         * `to_lane`の逆変換である。既定ではそのまま返す。\n
+         * \param val レーンの形式。\n
+         * \return 変換した内部表現。\n
+         */
+        virtual residue from_lane(const residue& val);
+
+        /*!\brief 並べた内部表現同士をレーンごとに乗算する。
+         *
+         * 配列の形式は`ecc::batch_kernels`と同じであり、各レーンは<!--
+         * -->`to_lane`で変換した形式である。\n
+         * 既定では何もせずに偽を返し、呼び出し側がレーンごとに<!--
+         * -->`multiply`を呼ぶ。\n
+         * \param lhs 被乗数の内部表現の桁の配列。\n
+         * \param rhs 乗数の内部表現の桁の配列。\n
+         * \param lan レーンの数。\n
+         * \param pro 計算した積の内部表現の桁の配列。\n
+         * \return 計算したら真、しなければ偽。\n
+         */
+        virtual bool multiply_lanes(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const size_t& lan,
+            uint64_t*const pro
+        );
+
+        /*!\brief 内部表現を広い内部表現に変換する。
+         *
+         * `ecc::element_acc`が元を積の和に加えるときに使う。\n
+         * \param val 内部表現。\n
+         * \return 変換した広い内部表現。位数の2乗未満となる。\n
+         */
+        virtual wide_residue widen(const residue& val);
+
+        /*!\brief 内部表現同士を剰余を計算せずに乗算する。
+         *
+         * 既定では`ecc::multiply_wide`で計算する。\n
+         * \param lhs 被乗数の内部表現。\n
+         * \param rhs 乗数の内部表現。\n
+         * \return 計算した積の広い内部表現。位数の2乗未満となる。\n
+         */
+        virtual wide_residue multiply_unreduced
+            (const residue& lhs, const residue& rhs);
+
+        /*!\brief 広い内部表現の剰余を計算する。
+         *
+         * 既定では`ecc::reduce_wide`で計算する。\n
+         * `acc_cap_`は、位数の2乗未満の広い内部表現をいくつまで足して<!--
+         * -->から渡してよいかを表す。`2`以上でなければならない。\n
+         * \param val 広い内部表現。\n
+         * \return 計算した剰余の内部表現。\n
+         */
+        virtual residue reduce_product(const wide_residue& val);
+    private:
+        V leg_exp_, roo_exp_, odd_par_, non_pow_;
+        size_t two_adi_;
+
+        friend class element<V>;
+        friend class element_acc<V>;
+        template <typename V_, size_t L> friend class element_batch;
+        template <typename V_> friend element<V_> square
+            (const element<V_>& ele);
+        template <typename V_> friend element<V_> halve
+            (const element<V_>& ele);
+        template <typename V_> friend element<V_> pow
+            (const element<V_>& ele, const V_& exp);
+        template <typename V_, size_t N> friend element<V_> pow
+            (const element<V_>& ele, const addition_chain_step (&cha)[N]);
+        template <typename I> friend void invert_batch
+            (const I& beg, const I& end);
+        template <typename V_> friend bool is_square
+            (const element<V_>& ele);
+        template <typename V_> friend element<V_> square_root
+            (const element<V_>& ele);
+    };
+
+    /*!\brief モンゴメリ表現を使う素体を表す。
+     *
+     * `ecc::PrimeField`の代わりに使うことができる。\n
+     * 元の値\f$ a \f$を\f$ aR \bmod p \f$(\f$ R = 2^{64n} \f$、<!--
+     * -->\f$ n \f$は位数のフィールドの数)として保持し、乗算をモンゴ<!--
+     * -->メリ還元で行う。\n
+     * 乗算のたびに除算する必要がなくなるので、`ecc::rational_point`<!--
+     * -->のスカラー倍算が速くなる。\n
+     * 値の変換は`ecc::element`を構築するときと`ecc::element::value`<!--
+     * -->で値を取得するときにしか行われない。\n
+     * \code
+     * auto F = std::make_shared<ecc::MontgomeryField<ecc::big_int<20>>>
+     *     (ecc::big_int<20>("1461501637330902918203684832716283019653785059327"));
+     * auto fe = ecc::make_factory<ecc::element<ecc::big_int<20>>>(F.get());
+     * \endcode
+     * \tparam V 値の型(`ecc::big_int`)。\n
+     */
+    template <typename V> class MontgomeryField : public PrimeField<V> {
+    public:
+        //!\brief 内部表現の型。
+        using residue = typename PrimeField<V>::residue;
+
+        //!\brief 広い内部表現の型。
+        using wide_residue = typename PrimeField<V>::wide_residue;
+
+        /*!\brief インスタンスを構築する。
+         *
+         * \f$ R^2 \bmod p \f$、\f$ R^3 \bmod p \f$、<!--
+         * -->\f$ -p^{-1} \bmod 2^{64} \f$を事前に計算しておく。\n
+         * \param ord 位数。\n
+         * \warning `ord`は`2`より大きい素数でなければならない。\n
+         */
+        MontgomeryField(const V& ord);
+    protected:
+        virtual residue encode(const V& val) override;
+        virtual V decode(const residue& val) override;
+        virtual residue multiply
+            (const residue& lhs, const residue& rhs) override;
+        virtual residue square(const residue& val) override;
+        virtual residue invert(const residue& val) override;
+        virtual bool multiply_lanes(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const size_t& lan,
+            uint64_t*const pro
+        ) override;
+        virtual wide_residue widen(const residue& val) override;
+        virtual wide_residue multiply_unreduced
+            (const residue& lhs, const residue& rhs) override;
+        virtual residue reduce_product(const wide_residue& val) override;
+    private:
+        size_t len_;
+        uint64_t neg_inv_;
+        residue r1_, r2_, r3_;
+        residue subtract_order(const uint64_t*const num);
+    };
+
+    /*!\brief 特殊な形の位数を持つ素体を表す。
+     *
+     * `ecc::PrimeField`の代わりに使うことができる。\n
+     * 位数が\f$ 2^k - c \f$(\f$ c \f$は\f$ 2^k \f$に比べて十分に小さ<!--
+     * -->い)の形をしている素体では、剰余を除算ではなく畳み込みで計算で<!--
+     * -->きる。\n
+     * 畳み込みの手順は核となるクラス`K`が定める。\n
+     * 核となるクラスは`ecc::secp160r1`、`ecc::secp192r1`、<!--
+     * -->`ecc::secp224r1`、`ecc::secp256r1`、`ecc::secp384r1`、<!--
+     * -->`ecc::secp521r1`、`ecc::secp256k1`のいずれかである。\n
+     * \code
+     * auto F = std::make_shared<ecc::SpecialPrimeField<
+     *     ecc::big_int<20>,
+     *     ecc::secp160r1
+     * >>();
+     * auto fe = ecc::make_factory<ecc::element<ecc::big_int<20>>>(F.get());
+     * \endcode
+     * \tparam V 値の型(`ecc::big_int`)。\n
+     * \tparam K 核となるクラス。\n
+     * \warning `V`は位数を表せる大きさでなければならない。\n
+     */
+    template <typename V, class K> class SpecialPrimeField :
+        public PrimeField<V>
+    {
+    public:
+        //!\brief 内部表現の型。
+        using residue = typename PrimeField<V>::residue;
+
+        //!\brief 広い内部表現の型。
+        using wide_residue = typename PrimeField<V>::wide_residue;
+
+        /*!\brief インスタンスを構築する。
+         *
+         * 位数は`K::ORDER`となる。\n
+         */
+        SpecialPrimeField();
+    protected:
+        virtual residue encode(const V& val) override;
+        virtual residue multiply
+            (const residue& lhs, const residue& rhs) override;
+        virtual residue square(const residue& val) override;
+        virtual residue reduce(const residue& val) override;
+        virtual residue square_root(const residue& val) override;
+        virtual wide_residue multiply_unreduced
+            (const residue& lhs, const residue& rhs) override;
+        virtual residue reduce_product(const wide_residue& val) override;
+    private:
+        wide_residue squ_ord_;
+        template <typename T> bool fold(const T& val, residue*const res);
+        residue square_root(const residue& val, std::true_type);
+        residue square_root(const residue& val, std::false_type);
+        static V make_order();
+    };
+
+    /*!\brief 加算連鎖の1段を表す。
+     *
+     * 指数が固定されている累乗を、決まった順序の2乗と乗算で計算する。\n
+     * 段の値は`source`番目の値を`squarings`回2乗し、`multiplier`番目<!--
+     * -->の値を掛けたものである。\n
+     * `0`番目の値は底であり、最後の段の値が累乗となる。\n
+     * 素体の核は逆数(\f$ a^{p-2} \f$)と平方根<!--
+     * -->(\f$ a^{(p+1)/4} \f$)の加算連鎖を持つことがある。\n
+     * \code
+     * auto r = ecc::pow(a, ecc::secp256k1::SQUARE_ROOT_CHAIN);
+     * \endcode
+     */
+    struct addition_chain_step {
+        //!\brief 掛ける値がないことを表す`multiplier`。
+        static constexpr size_t NO_MULTIPLIER = ~size_t(0);
+
+        //!\brief 2乗する値のインデックス。
+        size_t source;
+
+        //!\brief 2乗する回数。
+        size_t squarings;
+
+        //!\brief 2乗した結果に掛ける値のインデックス。
+        size_t multiplier;
+    };
+
+    /*!\brief 素体の核が平方根の加算連鎖を持つかどうかを判定する。
+     *
+     * `K::SQUARE_ROOT_CHAIN`があれば`std::true_type`、なければ<!--
+     * -->`std::false_type`を継承する。\n
+     * `ecc::SpecialPrimeField`が平方根の計算方法を選ぶときに使う。\n
+     * \tparam K 核となるクラス。\n
+     */
+    template <class K, typename> struct has_square_root_chain :
+        std::false_type {};
+
+    //!\brief `ecc::has_square_root_chain`を参照。
+    template <class K> struct has_square_root_chain
+        <K, decltype(void(K::SQUARE_ROOT_CHAIN))> : std::true_type {};
+
+    /*!\brief secp160r1の素体の核を表す。
+     *
+     * 位数は\f$ 2^{160} - 2^{31} - 1 \f$である。\n
+     */
+    struct secp160r1 {
+        //!\brief 位数のフィールドの数。
+        static constexpr size_t NUMBER_OF_FIELDS = 3;
+
+        //!\brief 位数のフィールド。
+        static constexpr uint64_t ORDER[NUMBER_OF_FIELDS] = {
+            0xffffffff7fffffffull,
+            0xffffffffffffffffull,
+            0x00000000ffffffffull
+        };
+
+        /*!\brief 位数を法とした剰余を計算する。
+         * \param num `NUMBER_OF_FIELDS`の2倍のフィールド。剰余を下位<!--
+         * -->の`NUMBER_OF_FIELDS`個のフィールドに代入する。\n
+         * \warning `num`は位数の2乗未満でなければならない。\n
+         */
+        static void reduce(uint64_t*const num);
+    };
+
+    /*!\brief secp192r1(NIST P-192)の素体の核を表す。
+     *
+     * 位数は\f$ 2^{192} - 2^{64} - 1 \f$である。\n
+     */
+    struct secp192r1 {
+        //!\brief 位数のフィールドの数。
+        static constexpr size_t NUMBER_OF_FIELDS = 3;
+
+        //!\brief 位数のフィールド。
+        static constexpr uint64_t ORDER[NUMBER_OF_FIELDS] = {
+            0xffffffffffffffffull,
+            0xfffffffffffffffeull,
+            0xffffffffffffffffull
+        };
+
+        //!\brief `ecc::secp160r1::reduce`を参照。
+        static void reduce(uint64_t*const num);
+    };
+
+    /*!\brief secp224r1(NIST P-224)の素体の核を表す。
+     *
+     * 位数は\f$ 2^{224} - 2^{96} + 1 \f$である。\n
+     */
+    struct secp224r1 {
+        //!\brief 位数のフィールドの数。
+        static constexpr size_t NUMBER_OF_FIELDS = 4;
+
+        //!\brief 位数のフィールド。
+        static constexpr uint64_t ORDER[NUMBER_OF_FIELDS] = {
+            0x0000000000000001ull,
+            0xffffffff00000000ull,
+            0xffffffffffffffffull,
+            0x00000000ffffffffull
+        };
+
+        //!\brief `ecc::secp160r1::reduce`を参照。
+        static void reduce(uint64_t*const num);
+    };
+
+    /*!\brief secp256r1(NIST P-256)の素体の核を表す。
+     *
+     * 位数は\f$ 2^{256} - 2^{224} + 2^{192} + 2^{96} - 1 \f$である。\n
+     * 剰余はFIPS 186の32ビット単位のソリナス還元で計算する。\n
+     * 52ビットの桁の乗算は\f$ R = 2^{260} \f$のモンゴメリ乗算で<!--
+     * -->計算する。\f$ -p^{-1} \equiv 1 \pmod{2^{52}} \f$なので、<!--
+     * -->還元の係数を求める乗算が要らない。\n
+     */
+    struct secp256r1 {
+        //!\brief 位数のフィールドの数。
+        static constexpr size_t NUMBER_OF_FIELDS = 4;
+
+        //!\brief 位数のフィールド。
+        static constexpr uint64_t ORDER[NUMBER_OF_FIELDS] = {
+            0xffffffffffffffffull,
+            0x00000000ffffffffull,
+            0x0000000000000000ull,
+            0xffffffff00000001ull
+        };
+
+        //!\brief `ecc::secp256k1::NUMBER_OF_LIMBS`を参照。
+        static constexpr size_t NUMBER_OF_LIMBS = 5;
+
+        //!\brief `ecc::secp256k1::LIMB_SHIFT`を参照。
+        static constexpr size_t LIMB_SHIFT = 260;
+
+        //!\brief `ecc::secp256k1::LENGTH_OF_INVERSION_CHAIN`を参照。
+        static constexpr size_t LENGTH_OF_INVERSION_CHAIN = 12;
+
+        //!\brief `ecc::secp256k1::INVERSION_CHAIN`を参照。
+        static const addition_chain_step
+            INVERSION_CHAIN[LENGTH_OF_INVERSION_CHAIN];
+
+        //!\brief `ecc::secp256k1::LENGTH_OF_SQUARE_ROOT_CHAIN`を参照。
+        static constexpr size_t LENGTH_OF_SQUARE_ROOT_CHAIN = 10;
+
+        //!\brief `ecc::secp256k1::SQUARE_ROOT_CHAIN`を参照。
+        static const addition_chain_step
+            SQUARE_ROOT_CHAIN[LENGTH_OF_SQUARE_ROOT_CHAIN];
+
+        //!\brief `ecc::secp160r1::reduce`を参照。
+        static void reduce(uint64_t*const num);
+
+        //!\brief `ecc::secp256k1::normalize_limbs`を参照。
+        static void normalize_limbs(uint64_t*const lim);
+
+        //!\brief `ecc::secp256k1::multiply_limbs`を参照。
+        static void multiply_limbs(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            uint64_t*const pro
+        );
+
+        //!\brief `ecc::secp256k1::square_limbs`を参照。
+        static void square_limbs
+            (const uint64_t*const val, uint64_t*const pro);
+    };
+
+    /*!\brief secp384r1(NIST P-384)の素体の核を表す。
+     *
+     * 位数は\f$ 2^{384} - 2^{128} - 2^{96} + 2^{32} - 1 \f$である。\n
+     */
+    struct secp384r1 {
+        //!\brief 位数のフィールドの数。
+        static constexpr size_t NUMBER_OF_FIELDS = 6;
+
+        //!\brief 位数のフィールド。
+        static constexpr uint64_t ORDER[NUMBER_OF_FIELDS] = {
+            0x00000000ffffffffull,
+            0xffffffff00000000ull,
+            0xfffffffffffffffeull,
+            0xffffffffffffffffull,
+            0xffffffffffffffffull,
+            0xffffffffffffffffull
+        };
+
+        //!\brief `ecc::secp160r1::reduce`を参照。
+        static void reduce(uint64_t*const num);
+    };
+
+    /*!\brief secp521r1(NIST P-521)の素体の核を表す。
+     *
+     * 位数は\f$ 2^{521} - 1 \f$である。\n
+     */
+    struct secp521r1 {
+        //!\brief 位数のフィールドの数。
+        static constexpr size_t NUMBER_OF_FIELDS = 9;
+
+        //!\brief 位数のフィールド。
+        static constexpr uint64_t ORDER[NUMBER_OF_FIELDS] = {
+            0xffffffffffffffffull,
+            0xffffffffffffffffull,
+            0xffffffffffffffffull,
+            0xffffffffffffffffull,
+            0xffffffffffffffffull,
+            0xffffffffffffffffull,
+            0xffffffffffffffffull,
+            0xffffffffffffffffull,
+            0x00000000000001ffull
+        };
+
+        //!\brief `ecc::secp256k1::LENGTH_OF_INVERSION_CHAIN`を参照。
+        static constexpr size_t LENGTH_OF_INVERSION_CHAIN = 13;
+
+        //!\brief `ecc::secp256k1::INVERSION_CHAIN`を参照。
+        static const addition_chain_step
+            INVERSION_CHAIN[LENGTH_OF_INVERSION_CHAIN];
+
+        //!\brief `ecc::secp256k1::LENGTH_OF_SQUARE_ROOT_CHAIN`を参照。
+        static constexpr size_t LENGTH_OF_SQUARE_ROOT_CHAIN = 1;
+
+        //!\brief `ecc::secp256k1::SQUARE_ROOT_CHAIN`を参照。
+        static const addition_chain_step
+            SQUARE_ROOT_CHAIN[LENGTH_OF_SQUARE_ROOT_CHAIN];
+
+        //!\brief `ecc::secp160r1::reduce`を参照。
+        static void reduce(uint64_t*const num);
+    };
+
+    /*!\brief secp256k1の素体の核を表す。
+     *
+     * 位数は\f$ 2^{256} - 2^{32} - 977 \f$である。\n
+     * 52ビットの桁の乗算は\f$ 2^{260} \equiv 2^4(2^{32} + 977) \f$<!--
+     * -->で上位の桁を畳み込んで計算する。\n
+     */
+    struct secp256k1 {
+        //!\brief 位数のフィールドの数。
+        static constexpr size_t NUMBER_OF_FIELDS = 4;
+
+        //!\brief 位数のフィールド。
+        static constexpr uint64_t ORDER[NUMBER_OF_FIELDS] = {
+            0xfffffffefffffc2full,
+            0xffffffffffffffffull,
+            0xffffffffffffffffull,
+            0xffffffffffffffffull
+        };
+
+        //!\brief `ecc::UnsaturatedField`の内部表現の52ビットの桁の数。
+        static constexpr size_t NUMBER_OF_LIMBS = 5;
+
+        /*!\brief 52ビットの桁の乗算が掛ける\f$ 2^{-k} \f$の\f$ k \f$。
+         *
+         * `0`でなければ内部表現はモンゴメリ表現となる。\n
+         */
+        static constexpr size_t LIMB_SHIFT = 0;
+
+        //!\brief 逆数を計算する加算連鎖の段の数。
+        static constexpr size_t LENGTH_OF_INVERSION_CHAIN = 15;
+
+        /*!\brief 逆数を計算する加算連鎖。
+         *
+         * 指数は\f$ p - 2 \f$であり、2乗255回と乗算15回で済む。\n
+         */
+        static const addition_chain_step
+            INVERSION_CHAIN[LENGTH_OF_INVERSION_CHAIN];
+
+        //!\brief 平方根を計算する加算連鎖の段の数。
+        static constexpr size_t LENGTH_OF_SQUARE_ROOT_CHAIN = 14;
+
+        /*!\brief 平方根を計算する加算連鎖。
+         *
+         * \f$ p \equiv 3 \pmod 4 \f$なので、指数は<!--
+         * -->\f$ (p + 1) / 4 \f$である。\n
+         * 結果の2乗が元に等しくなければ平方根は存在しない。\n
+         */
+        static const addition_chain_step
+            SQUARE_ROOT_CHAIN[LENGTH_OF_SQUARE_ROOT_CHAIN];
+
+        //!\brief `ecc::secp160r1::reduce`を参照。
+        static void reduce(uint64_t*const num);
+
+        /*!\brief 52ビットの桁の配列を弱く正規化する。
+         *
+         * 桁上がりを処理し、\f$ 2^{256} \f$以上の部分を畳み込む。\n
+         * 正規化した配列の下位4個の桁は\f$ 2^{52} \f$未満、最上位の<!--
+         * -->桁は\f$ 2^{49} \f$未満となるが、位数未満とは限らない。\n
+         * \param lim `NUMBER_OF_LIMBS`個の桁の配列。\n
+         * \warning `lim`の桁はすべて\f$ 2^{59} \f$未満でなければなら<!--
+         * -->ない。\n
+         */
+        static void normalize_limbs(uint64_t*const lim);
+
+        /*!\brief 52ビットの桁の配列同士を乗算する。
+         *
+         * 積に\f$ 2^{-k} \f$(\f$ k \f$は`LIMB_SHIFT`)を掛けた値の<!--
+         * -->剰余を弱く正規化した配列として計算する。\n
+         * \param lhs 被乗数の桁の配列。\n
+         * \param rhs 乗数の桁の配列。\n
+         * \param pro 積を代入する`NUMBER_OF_LIMBS`個の桁の配列。\n
+         * \warning `lhs`と`rhs`は弱く正規化されていなければならない。\n
+         */
+        static void multiply_limbs(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            uint64_t*const pro
+        );
+
+        /*!\brief 52ビットの桁の配列を2乗する。
+         * \param val 桁の配列。\n
+         * \param pro 2乗を代入する`NUMBER_OF_LIMBS`個の桁の配列。\n
+         * \warning `val`は弱く正規化されていなければならない。\n
+         */
+        static void square_limbs
+            (const uint64_t*const val, uint64_t*const pro);
+    };
+
+    /*!\brief 非飽和の52ビットの桁で内部表現を保持する素体を表す。
+     *
+     * `ecc::PrimeField`の代わりに使うことができる。\n
+     * 256ビットの位数の内部表現を5個の52ビットの桁として、内部表現の<!--
+     * -->フィールドに1個ずつ保持する。\n
+     * 各フィールドの上位12ビットが空いているので、加算と減算は桁上が<!--
+     * -->りを処理せずに桁ごとに行う。\n
+     * 桁上がりは桁が\f$ 2^{58} \f$に達したとき、乗算の前、比較の前に<!--
+     * -->しか処理しない。\n
+     * 有理点の演算のように1回の乗算あたりの加減算が多い場合に速くなる。\n
+     * 桁の乗算と還元は核となるクラス`K`が定める。\n
+     * 核となるクラスは`ecc::secp256r1`、`ecc::secp256k1`のいずれかで<!--
+     * -->ある。\n
+     * \code
+     * auto F = std::make_shared<ecc::UnsaturatedField<
+     *     ecc::big_int<32>,
+     *     ecc::secp256k1
+     * >>();
+     * auto fe = ecc::make_factory<ecc::element<ecc::big_int<32>>>(F.get());
+     * \endcode
+     * \tparam V 値の型(`ecc::big_int`)。\n
+     * \tparam K 核となるクラス。\n
+     * \warning 内部表現は`K::NUMBER_OF_LIMBS`個以上のフィールドを持た<!--
+     * -->なければならない。\n
+     */
+    template <typename V, class K> class UnsaturatedField :
+        public PrimeField<V>
+    {
+    public:
+        //!\brief 内部表現の型。
+        using residue = typename PrimeField<V>::residue;
+
+        //!\brief 広い内部表現の型。
+        using wide_residue = typename PrimeField<V>::wide_residue;
+
+        /*!\brief インスタンスを構築する。
+         *
+         * 位数は`K::ORDER`となる。\n
+         */
+        UnsaturatedField();
+    protected:
+        virtual residue encode(const V& val) override;
+        virtual V decode(const residue& val) override;
+        virtual residue multiply
+            (const residue& lhs, const residue& rhs) override;
+        virtual residue square(const residue& val) override;
+        virtual residue invert(const residue& val) override;
+        virtual residue reduce(const residue& val) override;
+        virtual residue add
+            (const residue& lhs, const residue& rhs) override;
+        virtual residue subtract
+            (const residue& lhs, const residue& rhs) override;
+        virtual bool equal(const residue& lhs, const residue& rhs) override;
+        virtual residue halve(const residue& val) override;
+        virtual residue square_root(const residue& val) override;
+        virtual residue to_lane(const residue& val) override;
+        virtual residue from_lane(const residue& val) override;
+        virtual wide_residue widen(const residue& val) override;
+        virtual wide_residue multiply_unreduced
+            (const residue& lhs, const residue& rhs) override;
+        virtual residue reduce_product(const wide_residue& val) override;
     private:
-        V ord_;
+        residue ord_lim_, bia_, r2_, r3_;
+        residue canonicalize(const residue& val);
+        residue pack(const residue& val);
+        static residue normalize(const residue& val);
+        static residue split(const residue& val);
+        static bool weak(const residue& val);
+        static V make_order();
     };
 
     /*!\brief 素体の元を表す。
@@ -1371,57 +2129,461 @@ namespace ecc {
          */
         V value() const;
     private:
+        using residue = typename PrimeField<V>::residue;
         PrimeField<V>* pri_fie_;
-        V val_;
+        residue val_;
+        static element from_internal
+            (PrimeField<V>*const priFie, const residue& val);
+        template <typename V_> friend element<V_> square
+            (const element<V_>& ele);
+        template <typename V_> friend element<V_> halve
+            (const element<V_>& ele);
+        template <typename V_> friend bool is_square(const element<V_>& ele);
+        template <typename V_> friend element<V_> square_root
+            (const element<V_>& ele);
+        template <typename V_> friend element<V_> pow
+            (const element<V_>& ele, const V_& exp);
+        template <typename V_, size_t N> friend element<V_> pow
+            (const element<V_>& ele, const addition_chain_step (&cha)[N]);
+        template <typename I> friend void invert_batch
+            (const I& beg, const I& end);
         template <typename V_> friend std::ostream& operator<<
             (std::ostream& os, const element<V_>& ele);
+        friend class element_acc<V>;
+        template <typename V_, size_t L> friend class element_batch;
     };
 
-    /*!\brief 素体上の楕円曲線を表す。
+    /*!\brief 同じ素体の元を複数並べたもの。
      *
-     * 係数、生成源である`ecc::PrimeField`へのバックポインタを保持する。\n
-     * `ecc::rational_point`の生成源である。\n
-     * \tparam V 値の型(整数型)。\n
+     * 内部表現を素体の`to_lane`で変換して`ecc::big_int_batch`として<!--
+     * -->保持し、全レーンを同時に演算する。\n
+     * 複数のスカラー倍算などを1つのコアで歩調を合わせて進めるときに<!--
+     * -->使う。\n
+     * 加算と減算は常に並列に演算される。\n
+     * 乗算はAVX2に対応したCPUの`ecc::MontgomeryField`なら並列に、<!--
+     * -->それ以外ならレーンごとに素体の乗算で演算される。\n
+     * \code
+     * auto F = std::make_shared<ecc::MontgomeryField<ecc::big_int<32>>>(p);
+     * auto fe = ecc::make_factory<ecc::element<ecc::big_int<32>>>(F.get());
+     * auto a = ecc::element_batch<ecc::big_int<32>>(F.get());
+     * for (size_t i = 0; i < 4; ++i) a.set(i, fe(ecc::big_int<32>(i)));
+     * auto b = a * a - a;
+     * auto e = b.get(3); // fe(6)
+     * \endcode
+     * \tparam V 値の型(`ecc::big_int`)。\n
+     * \tparam L レーンの数。既定値は`4`。\n
      */
-    template <typename V> class EllipticCurve {
+    template <typename V, size_t L = 4> class element_batch {
     public:
-        /*!\brief 素体、係数からインスタンスを構築する。
+        //!\brief レーンの数。
+        static constexpr size_t NUMBER_OF_LANES = L;
+
+        /*!\brief 素体からインスタンスを構築する。
+         * \post すべてのレーンの値は`0`となる。\n
          * \param priFie 素体。\n
-         * \param coeA 1次の項の係数。\n
-         * \param coeB 0次の項の係数。\n
          */
-        EllipticCurve(
-            PrimeField<V>*const priFie,
-            const element<V>& coeA,
-            const element<V>& coeB
-        );
+        explicit element_batch(PrimeField<V>*const priFie);
 
-        /*!\brief 1次の項の係数を取得する。\n
-         * \return 取得した1次の項の係数。\n
+        /*!\brief レーンの元を取得する。
+         * \param lan レーンの番号。\n
+         * \return 取得した元。\n
          */
-        element<V> coefficientA();
+        element<V> get(const size_t& lan) const;
 
-        /*!\brief 0次の項の係数を取得する。\n
-         * \return 取得した0次の項の係数。\n
+        /*!\brief レーンに元を設定する。
+         *
+         * 元の素体は無視され、このインスタンスの素体の元とみなされる。\n
+         * \param lan レーンの番号。\n
+         * \param ele 設定する元。\n
          */
-        element<V> coefficientB();
+        void set(const size_t& lan, const element<V>& ele);
 
-        /*!\brief 素体を取得する。
-         * \return 取得した素体。\n
+        /*!\brief レーンごとにモジュラー算術で乗算する。
+         * \param rhs 乗数。\n
+         * \return 計算した積。\n
          */
-        PrimeField<V>* primeField();
+        element_batch operator*(const element_batch& rhs) const;
+
+        /*!\brief レーンごとにモジュラー算術で加算する。
+         * \param rhs 加数。\n
+         * \return 計算した和。\n
+         */
+        element_batch operator+(const element_batch& rhs) const;
+
+        /*!\brief レーンごとにモジュラー算術で減算する。
+         * \param rhs 減数。\n
+         * \return 計算した差。\n
+         */
+        element_batch operator-(const element_batch& rhs) const;
     private:
-        element<V> coeA_, coeB_;
-        PrimeField<V>* priFie_;
+        using residue = typename PrimeField<V>::residue;
+        using digits = big_int_batch<residue, L>;
+        PrimeField<V>* pri_fie_;
+        digits val_;
+        void order(uint64_t*const ord) const;
     };
 
-    /*!\brief 楕円曲線上の有理点を表す。
+    /*!\brief 素体の元の積の和を、剰余を計算せずに蓄積する。
      *
-     * 無限遠点フラグ、座標、生成源である`ecc::EllipticCurve`へのバッ<!--
-     * -->クポインタを保持する。\n
-     * 座標はヤコビアン座標系(x, y, z)である。\n
-     * アフィン座標系(X, Y)とは次のような関係になる。\n
-     * \n
+     * 積を広い内部表現のまま足し合わせ、`value`で1回だけ剰余を計算す<!--
+     * -->る。\n
+     * `a * b + c * d`のような式を`element`の演算子で計算すると剰余を<!--
+     * -->3回計算するが、これなら1回で済む。\n
+     * 広い内部表現の余りのフィールドに収まる数の積を足したら、その時<!--
+     * -->点で剰余を計算して蓄積し直すので、桁があふれることはない。\n
+     * \code
+     * auto acc = ecc::element_acc<ecc::big_int<32>>(F.get());
+     * acc.multiply_add(a, b);
+     * acc.multiply_subtract(c, d);
+     * acc += e;
+     * auto f = acc.value(); // a * b - c * d + e
+     * \endcode
+     * \tparam V 値の型(整数型)。\n
+     */
+    template <typename V> class element_acc {
+    public:
+        /*!\brief 素体からインスタンスを構築する。
+         * \post 値は`0`となる。\n
+         * \param priFie 素体。\n
+         */
+        explicit element_acc(PrimeField<V>*const priFie);
+
+        /*!\brief 元を加算する。
+         * \param rhs 加数。\n
+         * \return 加算したインスタンス。\n
+         */
+        element_acc& operator+=(const element<V>& rhs);
+
+        /*!\brief 元を減算する。
+         * \param rhs 減数。\n
+         * \return 減算したインスタンス。\n
+         */
+        element_acc& operator-=(const element<V>& rhs);
+
+        /*!\brief 元同士の積を加算する。
+         * \param lhs 被乗数。\n
+         * \param rhs 乗数。\n
+         * \return 加算したインスタンス。\n
+         */
+        element_acc& multiply_add
+            (const element<V>& lhs, const element<V>& rhs);
+
+        /*!\brief 元同士の積を減算する。
+         * \param lhs 被乗数。\n
+         * \param rhs 乗数。\n
+         * \return 減算したインスタンス。\n
+         */
+        element_acc& multiply_subtract
+            (const element<V>& lhs, const element<V>& rhs);
+
+        /*!\brief 蓄積した和の剰余を計算し、元として取得する。
+         * \return 取得した元。\n
+         */
+        element<V> value() const;
+    private:
+        using residue = typename PrimeField<V>::residue;
+        using wide_residue = typename PrimeField<V>::wide_residue;
+        PrimeField<V>* pri_fie_;
+        wide_residue acc_;
+        size_t cnt_;
+        void accumulate(const wide_residue& ter);
+    };
+
+    /*!\brief 素体の元を2乗する。
+     *
+     * `ele * ele`と同じ結果になるが、素体の2乗の演算を使うので速い。\n
+     * \param ele 元。\n
+     * \return 計算した2乗。\n
+     */
+    template <typename V> element<V> square(const element<V>& ele);
+
+    /*!\brief 素体の元を半分にする。
+     *
+     * 2で割るのと同じ結果になるが、逆数を計算しないので速い。\n
+     * \param ele 元。\n
+     * \return 計算した値。\n
+     */
+    template <typename V> element<V> halve(const element<V>& ele);
+
+    /*!\brief 素体の元に小さな定数を掛ける。
+     *
+     * 2倍と加算を繰り返して計算する。\n
+     * 定数を元に変換して乗算するよりも、剰余の計算が少ないので速い。\n
+     * \param ele 元。\n
+     * \param mul 定数。\n
+     * \return 計算した積。\n
+     */
+    template <typename V> element<V> multiply_small
+        (const element<V>& ele, const unsigned& mul);
+
+    /*!\brief 素体の元が平方剰余かどうかを判定する。
+     *
+     * 素体の`is_square`に委ねる。\n
+     * 既定ではオイラーの規準で、\f$ a^{(p-1)/2} \f$が`1`かどうかを<!--
+     * -->調べる。\n
+     * \param ele 元。\n
+     * \return 平方剰余か`0`なら真、平方非剰余なら偽。\n
+     */
+    template <typename V> bool is_square(const element<V>& ele);
+
+    /*!\brief 素体の元の平方根を計算する。
+     *
+     * 素体の`square_root`に委ねる。\n
+     * 既定では位数\f$ p \f$が\f$ p \equiv 3 \pmod 4 \f$なら<!--
+     * -->\f$ a^{(p+1)/4} \f$で、\f$ p \equiv 5 \pmod 8 \f$ならアト<!--
+     * -->キンの方法で、\f$ p \equiv 1 \pmod 8 \f$ならトネリ・シャン<!--
+     * -->クスの方法で計算する。\n
+     * 核が平方根の加算連鎖を持つ`ecc::SpecialPrimeField`と<!--
+     * -->`ecc::UnsaturatedField`は、その加算連鎖で計算する。\n
+     * 2つある平方根のどちらになるかは定めない。\n
+     * \param ele 元。\n
+     * \return 計算した平方根。`ele`が平方非剰余なら、2乗しても<!--
+     * -->`ele`にならない値となる。\n
+     * \warning 位数は奇数でなければならない。\n
+     */
+    template <typename V> element<V> square_root(const element<V>& ele);
+
+    /*!\brief 素体の元を累乗する。
+     *
+     * スライディングウィンドウ法で計算する。\n
+     * 指数のビット長に応じてウィンドウの幅を決め、底の奇数乗を事前に<!--
+     * -->計算しておく。\n
+     * 2乗と乗算には素体の演算を使う。\n
+     * \param ele 底。\n
+     * \param exp 指数。\n
+     * \return 計算した累乗。\n
+     * \warning `exp`は`0`以上でなければならない。\n
+     */
+    template <typename V> element<V> pow(const element<V>& ele, const V& exp);
+
+    /*!\brief 素体の元を加算連鎖で累乗する。
+     *
+     * 指数が固定されている場合に、スライディングウィンドウ法よりも少<!--
+     * -->ない乗算で計算する。\n
+     * \code
+     * auto inv = ecc::pow(a, ecc::secp256k1::INVERSION_CHAIN);
+     * \endcode
+     * \tparam N 加算連鎖の段の数。\n
+     * \param ele 底。\n
+     * \param cha 加算連鎖。\n
+     * \return 計算した累乗。\n
+     */
+    template <typename V, size_t N> element<V> pow
+        (const element<V>& ele, const addition_chain_step (&cha)[N]);
+
+    /*!\brief 素体の元の範囲をまとめて逆数に置き換える。
+     *
+     * 元の累積積の逆数を1回だけ計算し、累積積を逆にたどって各元の逆<!--
+     * -->数を取り出す(モンゴメリのトリック)。\n
+     * `n`個の元に対して、逆数の計算1回と乗算`3(n - 1)`回で済む。\n
+     * 値が`0`の元はそのまま残す。\n
+     * \code
+     * std::vector<ecc::element<int>> Z;
+     * ...
+     * ecc::invert_batch(Z.begin(), Z.end());
+     * \endcode
+     * \tparam I 元を指す双方向反復子の型。\n
+     * \param beg 開始の元を指す反復子。\n
+     * \param end 終了の元を指す反復子。\n
+     * \warning 範囲内の元は同じ素体のものでなければならない。\n
+     */
+    template <typename I> void invert_batch(const I& beg, const I& end);
+
+    /*!\brief 位数がコンパイル時に定まる素体の元を表す。
+     *
+     * `ecc::element`と同じ演算子を持つが、素体へのポインタを持たない。\n
+     * 位数と剰余の手順は核となるクラス`K`の静的なメンバであり、値は<!--
+     * -->`K::NUMBER_OF_FIELDS`個のフィールドだけで保持する。\n
+     * 元が小さくなるので、有理点や事前計算の表がキャッシュに収まりや<!--
+     * -->すくなる。\n
+     * 演算は仮想関数を介さず、位数の定数は畳み込まれる。\n
+     * \code
+     * using fe = ecc::fp<ecc::big_int<32>, ecc::secp256k1>;
+     * auto a = fe(ecc::big_int<32>(3));
+     * auto b = square(a) + a;
+     * \endcode
+     * \tparam V 値の型(`ecc::big_int`)。\n
+     * \tparam K 核となるクラス。`ecc::SpecialPrimeField`と同じである。\n
+     * \warning `V`は位数を表せる大きさでなければならない。\n
+     */
+    template <typename V, class K> class fp {
+    public:
+        /*!\brief デフォルトコンストラクタ。
+         * \post 値は未定義となる。\n
+         */
+        fp() = default;
+
+        /*!\brief 値からインスタンスを構築する。
+         * \param val 値。位数を法とした剰余を保持する。\n
+         */
+        explicit fp(const V& val);
+
+        /*!\brief 等しくないかどうかを判定する。
+         * \param rhs 右側のオペランド。\n
+         * \return 等しくなければ真、等しければ偽。\n
+         */
+        bool operator!=(const fp& rhs) const;
+
+        /*!\brief モジュラー算術で乗算する。
+         * \param rhs 乗数。\n
+         * \return 計算した積。\n
+         */
+        fp operator*(const fp& rhs) const;
+
+        /*!\brief モジュラー算術で乗算し、代入する。
+         * \param rhs 乗数。\n
+         * \return 積を代入した左側のオペランド。\n
+         */
+        fp& operator*=(const fp& rhs);
+
+        /*!\brief モジュラー算術で加算する。
+         * \param rhs 加数。\n
+         * \return 計算した和。\n
+         */
+        fp operator+(const fp& rhs) const;
+
+        /*!\brief モジュラー算術で加算し、代入する。
+         * \param rhs 加数。\n
+         * \return 和を代入した左側のオペランド。\n
+         */
+        fp& operator+=(const fp& rhs);
+
+        /*!\brief モジュラー算術で正負を反転する。
+         * \return 正負を反転した値。\n
+         */
+        fp operator-() const;
+
+        /*!\brief モジュラー算術で減算する。
+         * \param rhs 減数。\n
+         * \return 計算した差。\n
+         */
+        fp operator-(const fp& rhs) const;
+
+        /*!\brief モジュラー算術で減算し、代入する。
+         * \param rhs 減数。\n
+         * \return 差を代入した左側のオペランド。\n
+         */
+        fp& operator-=(const fp& rhs);
+
+        /*!\brief モジュラー算術で除算する。
+         * \param rhs 除数。\n
+         * \return 計算した商。\n
+         * \warning `rhs`は非`0`でなければならない。\n
+         */
+        fp operator/(const fp& rhs) const;
+
+        /*!\brief モジュラー算術で除算し、代入する。
+         * \param rhs 除数。\n
+         * \return 商を代入した左側のオペランド。\n
+         * \warning `rhs`は非`0`でなければならない。\n
+         */
+        fp& operator/=(const fp& rhs);
+
+        /*!\brief 等しいかどうかを判定する。
+         * \param rhs 右側のオペランド。\n
+         * \return 等しければ真、等しくなければ偽。\n
+         */
+        bool operator==(const fp& rhs) const;
+
+        /*!\brief 非`0`かどうかを判定する。
+         * \return 非`0`なら真、`0`なら偽。\n
+         */
+        operator bool() const;
+
+        /*!\brief 値を取得する。
+         * \return 取得した値。必ず`0`以上、位数未満となる。\n
+         */
+        V value() const;
+    private:
+        static constexpr size_t N = K::NUMBER_OF_FIELDS;
+        uint64_t fies_[N];
+        void reduce(const uint64_t& car);
+        static V make_order();
+        template <typename V_, class K_> friend fp<V_, K_> square
+            (const fp<V_, K_>& ele);
+        template <typename V_, class K_> friend std::ostream& operator<<
+            (std::ostream& os, const fp<V_, K_>& ele);
+    };
+
+    /*!\brief 位数がコンパイル時に定まる素体の元を2乗する。
+     * \param ele 元。\n
+     * \return 計算した2乗。\n
+     */
+    template <typename V, class K> fp<V, K> square(const fp<V, K>& ele);
+
+    /*!\brief 位数がコンパイル時に定まる素体の元を累乗する。
+     *
+     * `ecc::pow`と同じくスライディングウィンドウ法で計算する。\n
+     * \param ele 底。\n
+     * \param exp 指数。\n
+     * \return 計算した累乗。\n
+     * \warning `exp`は`0`以上でなければならない。\n
+     */
+    template <typename V, class K> fp<V, K> pow
+        (const fp<V, K>& ele, const V& exp);
+
+    /*!\brief 位数がコンパイル時に定まる素体の元を加算連鎖で累乗する。
+     * \tparam N 加算連鎖の段の数。\n
+     * \param ele 底。\n
+     * \param cha 加算連鎖。\n
+     * \return 計算した累乗。\n
+     */
+    template <typename V, class K, size_t N> fp<V, K> pow
+        (const fp<V, K>& ele, const addition_chain_step (&cha)[N]);
+
+    /*!\brief 素体上の楕円曲線を表す。
+     *
+     * 係数、素体の`1`、生成源である`ecc::PrimeField`へのバックポインタ<!--
+     * -->を保持する。\n
+     * `ecc::rational_point`の生成源である。\n
+     * \tparam V 値の型(整数型)。\n
+     */
+    template <typename V> class EllipticCurve {
+    public:
+        /*!\brief 素体、係数からインスタンスを構築する。
+         * \param priFie 素体。\n
+         * \param coeA 1次の項の係数。\n
+         * \param coeB 0次の項の係数。\n
+         */
+        EllipticCurve(
+            PrimeField<V>*const priFie,
+            const element<V>& coeA,
+            const element<V>& coeB
+        );
+
+        /*!\brief 1次の項の係数を取得する。\n
+         * \return 取得した1次の項の係数。\n
+         */
+        element<V> coefficientA();
+
+        /*!\brief 0次の項の係数を取得する。\n
+         * \return 取得した0次の項の係数。\n
+         */
+        element<V> coefficientB();
+
+        /*!\brief 素体を取得する。
+         * \return 取得した素体。\n
+         */
+        PrimeField<V>* primeField();
+
+        /*!\brief 素体の`1`を取得する。
+         *
+         * 構築時に変換しておいたものを返すので、剰余を計算しない。\n
+         * \return 取得した`1`。\n
+         */
+        element<V> one();
+    private:
+        element<V> coeA_, coeB_, one_;
+        PrimeField<V>* priFie_;
+    };
+
+    /*!\brief 楕円曲線上の有理点を表す。
+     *
+     * 無限遠点フラグ、座標、生成源である`ecc::EllipticCurve`へのバッ<!--
+     * -->クポインタを保持する。\n
+     * 座標はヤコビアン座標系(x, y, z)である。\n
+     * アフィン座標系(X, Y)とは次のような関係になる。\n
+     * \n
      * \f$ (x, y, z) = ( \frac{x}{z^2}, \frac{y}{z^3}, 1) = (X, Y, 1) \f$\n
      * \n
      * \tparam V 値の型(整数型)。\n
@@ -1465,11 +2627,47 @@ namespace ecc {
          */
         rational_point(const rational_point& ano) = default;
 
+        /*!\brief x座標とy座標の偶奇から有理点を復元する。
+         *
+         * 曲線の式からy座標の2乗を計算し、`ecc::square_root`で平方根<!--
+         * -->を求める。\n
+         * 平方根と正負を反転したもののうち、偶奇が合う方をy座標とする。\n
+         * \code
+         * auto odd = P.is_odd();
+         * auto x = P.project().x();
+         * ...
+         * ecc::rational_point<ecc::big_int<20>> Q;
+         * if (!ecc::rational_point<ecc::big_int<20>>::decompress
+         *     (E.get(), x, odd, &Q)) ...
+         * \endcode
+         * \param ec 楕円曲線。\n
+         * \param x アフィン座標系のx座標。\n
+         * \param odd y座標が奇数なら真、偶数なら偽。\n
+         * \param poi 復元した有理点。結果を代入する。\n
+         * \return 復元できたら真、`x`に対応する有理点がなければ偽。\n
+         */
+        static bool decompress(
+            EllipticCurve<V>*const ec,
+            const element<V>& x,
+            const bool& odd,
+            rational_point*const poi
+        );
+
         /*!\brief 無限遠点フラグを取得する。
          * \return 無限遠点なら真、無限遠点以外なら偽。\n
          */
         bool is_infinity() const;
 
+        /*!\brief アフィン座標系のy座標が奇数かどうかを判定する。
+         *
+         * アフィン座標系のx座標とこの偶奇で、有理点を圧縮して表すことが<!--
+         * -->できる。\n
+         * z座標が`1`でなければ射影するので、逆数を計算する。\n
+         * \return 奇数なら真、偶数なら偽。\n
+         * \warning 無限遠点であってはならない。\n
+         */
+        bool is_odd() const;
+
         /*!\brief 等しくないかどうかを判定する。
          * \param rhs 右側のオペランド。\n
          */
@@ -1552,8 +2750,54 @@ namespace ecc {
             const element<V>& z,
             const element<V>& w
         );
+        rational_point add_affine(const rational_point& rhs) const;
         template <typename V_> friend std::ostream& operator<<
             (std::ostream& os, const rational_point<V_>& poi);
+        friend class FixedBaseTable<V>;
+    };
+
+    /*!\brief 固定された基準点のスカラー倍算の事前計算表を表す。
+     *
+     * リム・リーのくし形法で、スカラーのビットを`numOfTee`本の歯と<!--
+     * -->`numOfTab`個の表に分け、歯の組み合わせごとの点を事前に計算<!--
+     * -->しておく。\n
+     * 表の点はまとめて逆数を計算してアフィン座標系に射影しておく。\n
+     * スカラー倍算の2倍算は、ビット長を<!--
+     * -->`numOfTee * numOfTab`で割った回数で済む。\n
+     * \code
+     * auto T = std::make_shared<ecc::FixedBaseTable<ecc::big_int<20>>>(B);
+     * auto P = T->multiply(d);
+     * \endcode
+     * \tparam V 値の型(整数型)。\n
+     */
+    template <typename V> class FixedBaseTable {
+    public:
+        /*!\brief 基準点、歯の数、表の数からインスタンスを構築する。
+         *
+         * `numOfTab * (2^numOfTee - 1)`個の点を計算する。\n
+         * \param bas 基準点。\n
+         * \param numOfTee 歯の数。既定値は`4`。\n
+         * \param numOfTab 表の数。既定値は`2`。\n
+         * \warning `bas`は無限遠点であってはならない。\n
+         * \warning `numOfTee`は`1`以上`16`以下、`numOfTab`は`1`以上で<!--
+         * -->なければならない。範囲外なら`std::invalid_argument`を<!--
+         * -->スローする。\n
+         */
+        FixedBaseTable(
+            const rational_point<V>& bas,
+            const size_t& numOfTee = 4,
+            const size_t& numOfTab = 2
+        );
+
+        /*!\brief 基準点をスカラー倍算する。
+         * \param sca 元。\n
+         * \return 計算したスカラー倍点。\n
+         * \remarks `sca * bas`と同じ結果となる。\n
+         */
+        rational_point<V> multiply(const element<V>& sca) const;
+    private:
+        size_t numOfTee_, numOfTab_, lenOfRow_, lenOfCol_;
+        std::vector<rational_point<V>> pois_;
     };
 
     //@}
@@ -2053,7 +3297,7 @@ namespace ecc {
      * \code
      * auto num = ecc::big_int<20>("1461501637330902918203684832716283019653785059327");
      * int a = int(num >> 144) & 0xff; // 遅い
-     * int b = (num[4] >> 16) & 0xff;  // 速い
+     * int b = (num[2] >> 16) & 0xff;  // 速い
      * \endcode
      */
     //@{
@@ -2076,6 +3320,20 @@ namespace ecc {
      * -->ておき、`N`ビットまでの整数を演算する。\n
      * また`N`に符号ビットを含めない場合はさらに`1`ビットを必要とする。\n
      * この`2N+1`を物理的な大きさとすると`N`は論理的な大きさと言える。\n
+     * \section mbicbiwidth 記憶領域の幅
+     * 剰余のように乗算の結果を保持する必要がない値には`2N`ビットの記<!--
+     * -->憶領域は無駄である。\n
+     * `W`を偽にすると記憶領域は`N+1`ビットに狭まり、加算、減算、比<!--
+     * -->較、コピーで扱うフィールドの数がおよそ半分になる。\n
+     * 狭い記憶領域の整数同士の積は`ecc::multiply_wide`で広い記憶領域<!--
+     * -->の整数として計算し、`ecc::reduce_wide`で狭い記憶領域の剰余に<!--
+     * -->戻す。\n
+     * \code
+     * using narrow_int = ecc::big_int<20, false, false>;
+     * auto p = narrow_int("1461501637330902918203684832716283019653785059327");
+     * auto a = narrow_int("425826231723888350446541592701409065913635568770");
+     * auto b = ecc::reduce_wide(ecc::multiply_wide(a, a), p);
+     * \endcode
      * \section mbicbifield フィールド
      * フィールドは整数のデータ片である。\n
      * フィールドはできるだけ大きいほうが、計算量が少なく効率的である。\n
@@ -2083,42 +3341,63 @@ namespace ecc {
      * \n
      * 多倍長整数同士を演算する際は左右のオペランドのフィールド同士を<!--
      * -->そのまま演算する。\n
-     * 乗算でオーバーフローしないように、フィールドは64ビットのうち下<!--
-     * -->位32ビットだけを使い、上位32ビットは`0`で埋める。\n
+     * フィールドは64ビットすべてを使う。\n
+     * 加算と減算の桁上がり、桁借りは`ecc::add_with_carry`、<!--
+     * -->`ecc::subtract_with_borrow`で次のフィールドに伝搬させる。\n
+     * 乗算の部分積は`ecc::multiply_with_carry`で128ビットとして計算し<!--
+     * -->、上位64ビットを次のフィールドに伝搬させる。\n
      * \n
-     * 整数のビット列は32ビットごとに分割され、最下位から順にフィール<!--
+     * 整数のビット列は64ビットごとに分割され、最下位から順にフィール<!--
      * -->ドの配列に格納される。\n
      * フィールド内のバイトオーダーはリトルエンディアンとする。\n
+     * \section mbicbilayout 配置
+     * データメンバはフィールドの配列のみであり、トリビアルにコピーで<!--
+     * -->きる。\n
+     * したがって`std::memcpy`で複製したり、ファイルにマップしたりする<!--
+     * -->ことができる。\n
+     * 大きさは`NUMBER_OF_FIELDS * SIZE_OF_FIELD`を<!--
+     * -->`ECCRYPTO_BIG_INT_ALIGNMENT`の倍数に切り上げたものとなる。\n
+     * アライメントやバイトオーダーが異なる環境と共有する場合は<!--
+     * -->`to_bytes`でバイト列に変換する。\n
      * \section mbicbinegative 負
      * 負の値は2の補数で表す。\n
      * 正負は最上位の符号ビットで区別できる。\n
-     * 負の場合でもフィールドの上位32ビットは`0`で埋める。\n
+     * \section mbicbiunsigned 符号なし
+     * `U`が真なら最上位ビットを符号ビットとみなさず、符号なし整数とし<!--
+     * -->て扱う。\n
+     * 比較、除算、右シフト、`ecc::multiply_wide`で符号の処理を省くの<!--
+     * -->で、負にならない剰余を保持するのに向いている。\n
+     * `ecc::big_uint`はその別名である。\n
      * \tparam S 多倍長整数の論理的な大きさ(バイト長)。\n
      * \tparam C Sに符号ビットを含めるかどうかのフラグ。真なら含める、<!--
      * -->偽なら含めない。既定値は偽。\n
+     * \tparam W 記憶領域の幅のフラグ。真なら広い(`2N+1`ビット)、偽<!--
+     * -->なら狭い(`N+1`ビット)。既定値は真。\n
+     * \tparam U 符号なしのフラグ。真なら符号なし、偽なら符号付き。既<!--
+     * -->定値は偽。\n
      * \warning `S`は`1`以上でなければならない。\n
      */
-    template <size_t S, bool C = false> class big_int {
+    template <size_t S, bool C = false, bool W = true, bool U = false>
+        class big_int
+    {
     public:
         //!\brief 多倍長整数の論理的な大きさ(バイト長)。
         static constexpr size_t LOGICAL_SIZE = S;
 
         //!\brief フィールドの大きさ(バイト長)。
-        static constexpr size_t SIZE_OF_FIELD = sizeof(uint64_t) / 2;
+        static constexpr size_t SIZE_OF_FIELD = sizeof(uint64_t);
 
         //!\brief フィールドの長さ(ビット長)。
         static constexpr size_t LENGTH_OF_BITS_ON_FIELD =
             8 * SIZE_OF_FIELD;
 
         //!\brief フィールドを抽出するためのマスク。
-        static constexpr uint64_t FIELD_MASK =
-            (uint64_t(1) << LENGTH_OF_BITS_ON_FIELD) - 1;
+        static constexpr uint64_t FIELD_MASK = ~uint64_t(0);
 
         //!\brief フィールドの数。
         static constexpr size_t NUMBER_OF_FIELDS =
-            LOGICAL_SIZE < SIZE_OF_FIELD ?  2 :
-                (LOGICAL_SIZE * 2 + (C ? 0 : 1) + SIZE_OF_FIELD - 1) /
-                    SIZE_OF_FIELD;
+            (LOGICAL_SIZE * (W ? 2 : 1) + (C ? 0 : 1) + SIZE_OF_FIELD - 1) /
+                SIZE_OF_FIELD;
 
         /*!\brief デフォルトコンストラクタ。
          * \post すべてのフィールドの値は未定義となる。\n
@@ -2128,7 +3407,12 @@ namespace ecc {
         /*!\brief コピーコンストラクタ。
          * \param ano 他方のインスタンス。\n
          */
-        big_int(const big_int& ano);
+        big_int(const big_int& ano) = default;
+
+        /*!\brief ムーブコンストラクタ。
+         * \param ano 他方のインスタンス。\n
+         */
+        big_int(big_int&& ano) noexcept = default;
 
         /*!\brief `int`整数からインスタンスを構築する。
          * \param num `int`整数。\n
@@ -2150,6 +3434,32 @@ namespace ecc {
          */
         explicit big_int(const uint64_t& num);
 
+        /*!\brief リテラルからインスタンスを構築する。
+         *
+         * コンパイル時に評価できるので、定数を構築するときに文字列を<!--
+         * -->解析しなくて済む。\n
+         * \code
+         * constexpr ecc::big_int<20> p =
+         *     1461501637330902918203684832716283019653785059327_bi;
+         * \endcode
+         * \tparam CS リテラルの文字の列。\n
+         * \param lit リテラル。\n
+         * \warning 値が記憶領域に収まらない場合は上位が切り捨てられる。\n
+         */
+        template <char... CS> constexpr big_int
+            (const big_int_literal<CS...>& lit);
+
+        /*!\brief 記憶領域の幅が異なる多倍長整数からインスタンスを構築<!--
+         * -->する。
+         *
+         * 狭くなる場合は上位のフィールドが切り捨てられる。\n
+         * 広くなる場合は符号が拡張される。\n
+         * \tparam W_ 他方の記憶領域の幅のフラグ。\n
+         * \param ano 他方のインスタンス。\n
+         */
+        template <bool W_, bool U_> explicit big_int
+            (const big_int<S, C, W_, U_>& ano);
+
         /*!\brief 文字列からインスタンスを構築する。
          * \param str 文字列。\n
          * \param bas 基数のフラグ。既定値は`std::ios::dec`。\n
@@ -2186,6 +3496,37 @@ namespace ecc {
             const std::ios::fmtflags& bas = std::ios::dec
         );
 
+        /*!\brief バイト列からインスタンスを構築する。
+         *
+         * バイト列は符号なし整数とみなす。\n
+         * `std::function`を介さずにバイト列をまとめて変換するので、<!--
+         * -->1バイトずつ取り込むよりも速い。\n
+         * \param byts バイト列。\n
+         * \param siz `byts`の大きさ(バイト長)。\n
+         * \param ord バイトオーダー。ビッグエンディアンなら真、リト<!--
+         * -->ルエンディアンなら偽。既定値は真。\n
+         * \return 構築したインスタンス。\n
+         * \warning 値が記憶領域に収まらない場合は上位が切り捨てられる。\n
+         */
+        static big_int from_bytes(
+            const uint8_t*const byts,
+            const size_t& siz,
+            const bool& ord = true
+        );
+
+        /*!\brief バイト列に変換する。
+         * \param byts バイト列。結果を代入する。\n
+         * \param siz `byts`の大きさ(バイト長)。\n
+         * \param ord バイトオーダー。ビッグエンディアンなら真、リト<!--
+         * -->ルエンディアンなら偽。既定値は真。\n
+         * \remarks 記憶領域より大きい部分には`0`を書き込む。\n
+         */
+        void to_bytes(
+            uint8_t*const byts,
+            const size_t& siz,
+            const bool& ord = true
+        ) const;
+
         /*!\brief ビット論理積を計算する。
          * \param rhs 右側のオペランド。\n
          * \return 計算したビット論理積。\n
@@ -2354,7 +3695,13 @@ namespace ecc {
          * \param rhs 代入するインスタンス。\n
          * \return 代入した左側のオペランド。\n
          */
-        big_int& operator=(const big_int& rhs);
+        big_int& operator=(const big_int& rhs) = default;
+
+        /*!\brief ムーブ代入する。
+         * \param rhs 代入するインスタンス。\n
+         * \return 代入した左側のオペランド。\n
+         */
+        big_int& operator=(big_int&& rhs) noexcept = default;
 
         /*!\brief 等しいかどうかを判定する。
          * \param rhs 右側のオペランド。\n
@@ -2414,7 +3761,6 @@ namespace ecc {
          * \return 参照したフィールド。\n
          * \warning `index`は`0`以上、`NUMBER_OF_FIELDS`未満でなければ<!--
          * -->ならない。\n
-         * フィールドの上位32ビットを非`0`に変更してはならない。\n
          */
         uint64_t& operator[](const size_t& index);
 
@@ -2448,46 +3794,787 @@ namespace ecc {
          */
         big_int operator~() const;
     private:
-        uint64_t fies_[NUMBER_OF_FIELDS];
+        static_assert(
+            ECCRYPTO_BIG_INT_ALIGNMENT >= alignof(uint64_t) &&
+                !(ECCRYPTO_BIG_INT_ALIGNMENT &
+                    (ECCRYPTO_BIG_INT_ALIGNMENT - 1)),
+            "the alignment must be a power of 2 not less than 8"
+        );
+        alignas(ECCRYPTO_BIG_INT_ALIGNMENT)
+            uint64_t fies_[NUMBER_OF_FIELDS];
         int64_t compare(const big_int& rhs) const;
         big_int divide(const big_int& rhs, big_int*const quo) const;
         bool msb() const;
-        template <size_t S_, bool C_> friend std::ostream& operator<<
-            (std::ostream& os, const big_int<S_, C_>& num);
-        template <size_t S_, bool C_> friend std::istream& operator>>
-            (std::istream& is, big_int<S_, C_>& num);
+        template <size_t S_, bool C_, bool W_, bool U_>
+            friend std::ostream& operator<<
+                (std::ostream& os, const big_int<S_, C_, W_, U_>& num);
+        template <size_t S_, bool C_, bool W_, bool U_>
+            friend std::istream& operator>>
+                (std::istream& is, big_int<S_, C_, W_, U_>& num);
     };
 
-    template <size_t S, bool C> constexpr size_t
-        LOGICAL_SIZE_OF_SPECIALIZED(const big_int<S, C>& val);
-    template <size_t S, bool O, size_t Z, bool C> big_int<Z, C>
-        bytes_to_number_specialized
-            (const big_int<Z, C>& val, const get_byte& getByt);
-    template <size_t S, bool O, size_t Z, bool C>
-        void number_to_bytes_specialized
-            (const big_int<Z, C>& num, const put_byte& putByt);
-
-    //@}
-
-    //---- helper declaration ----
-
-    /*!\defgroup mhelper 補助
-     * このモジュールには`eccrypto`ライブラリの使用を補助するための機<!--
-     * -->能が含まれる。\n
-     @{*/
+    /*!\brief 符号なしの多倍長整数。
+     * \tparam S 多倍長整数の論理的な大きさ(バイト長)。\n
+     * \tparam C Sに符号ビットを含めるかどうかのフラグ。既定値は偽。\n
+     * \tparam W 記憶領域の幅のフラグ。既定値は偽。\n
+     */
+    template <size_t S, bool C = false, bool W = false> using big_uint =
+        big_int<S, C, W, true>;
 
-    /*!\brief 値オブジェクトを構築するファクトリーを表す。
+    /*!\brief 同じ型の多倍長整数を複数並べたもの。
      *
-     * 値オブジェクトを構築する際に生成源となるオブジェクトを渡す。\n
-     * \tparam V 値オブジェクトの型。\n
-     * \tparam G 生成源の型。\n
+     * 多倍長整数を32ビットの桁に分け、桁ごとに全レーンを並べて保持す<!--
+     * -->る(SoA)。\n
+     * 各レーンは独立に演算され、演算は`ecc::kernels_for_batch`の<!--
+     * -->カーネルで行われる。\n
+     * AVX2に対応したCPUでは4個のレーンを1命令で演算する。\n
+     * \code
+     * auto a = ecc::big_int_batch<ecc::big_uint<32>>();
+     * for (size_t i = 0; i < 4; ++i) a.set(i, ecc::big_uint<32>(i + 1));
+     * auto b = a * a + a; // 各レーンでi * i + i
+     * \endcode
+     * \tparam N 多倍長整数の型(`ecc::big_int`)。\n
+     * \tparam L レーンの数。既定値は`4`。\n
      */
-    template <typename V, class G> class factory {
+    template <typename N, size_t L = 4> class big_int_batch {
     public:
-        /*!\brief インスタンスを構築する。
-         * \param gen 生成源。\n
-         */
-        factory(G*const gen);
+        //!\brief レーンの数。
+        static constexpr size_t NUMBER_OF_LANES = L;
+
+        //!\brief 1個の多倍長整数の32ビットの桁の数。
+        static constexpr size_t NUMBER_OF_DIGITS = 2 * N::NUMBER_OF_FIELDS;
+
+        /*!\brief デフォルトコンストラクタ。
+         * \post すべてのレーンの値は`0`となる。\n
+         */
+        big_int_batch();
+
+        /*!\brief 多倍長整数からインスタンスを構築する。
+         * \param num すべてのレーンに設定する多倍長整数。\n
+         */
+        explicit big_int_batch(const N& num);
+
+        /*!\brief レーンの値を取得する。
+         * \param lan レーンの番号。\n
+         * \return 取得した値。\n
+         */
+        N get(const size_t& lan) const;
+
+        /*!\brief レーンに値を設定する。
+         * \param lan レーンの番号。\n
+         * \param num 設定する値。\n
+         */
+        void set(const size_t& lan, const N& num);
+
+        /*!\brief レーンごとに乗算する。
+         *
+         * 積は`N`と同じくフィールドの幅で切り捨てられる。\n
+         * \param rhs 乗数。\n
+         * \return 計算した積。\n
+         */
+        big_int_batch operator*(const big_int_batch& rhs) const;
+
+        /*!\brief レーンごとに加算する。
+         * \param rhs 加数。\n
+         * \return 計算した和。\n
+         */
+        big_int_batch operator+(const big_int_batch& rhs) const;
+
+        /*!\brief レーンごとに減算する。
+         * \param rhs 減数。\n
+         * \return 計算した差。\n
+         */
+        big_int_batch operator-(const big_int_batch& rhs) const;
+    private:
+        alignas(32) uint64_t digs_[NUMBER_OF_DIGITS * L];
+        template <typename V, size_t L_> friend class element_batch;
+    };
+
+    /*!\brief 多倍長整数のリテラル。
+     *
+     * `ecc::operator""_bi`が返す。\n
+     * 任意の`ecc::big_int`に暗黙に変換できる。\n
+     * \tparam CS リテラルの文字の列。\n
+     */
+    template <char... CS> class big_int_literal {
+    public:
+        /*!\brief インスタンスを構築する。
+         * \param neg 負かどうかのフラグ。既定値は偽。\n
+         */
+        constexpr explicit big_int_literal(const bool& neg = false);
+
+        /*!\brief 符号を反転する。
+         * \return 符号を反転したリテラル。\n
+         */
+        constexpr big_int_literal operator-() const;
+
+        /*!\brief 負かどうかを判定する。
+         * \return 負なら真、正なら偽。\n
+         */
+        constexpr bool negative() const;
+    private:
+        bool neg_;
+    };
+
+    /*!\brief 多倍長整数のリテラルを作る。
+     *
+     * 10進数の他、`0x`で始まる16進数、`0b`で始まる2進数、`0`で始まる<!--
+     * -->8進数を書くことができる。\n
+     * \code
+     * using namespace ecc;
+     * auto a = big_int<20>(0xffffffffffffffffffffffffffffffff7fffffff_bi);
+     * auto b = big_int<20>(-3_bi);
+     * \endcode
+     * \tparam CS リテラルの文字の列。\n
+     * \return 作ったリテラル。\n
+     */
+    template <char... CS> constexpr big_int_literal<CS...> operator"" _bi();
+
+    /*!\brief 桁上がりを伴って加算する。
+     * \param lhs 被加数。\n
+     * \param rhs 加数。\n
+     * \param car 桁上がり(`0`か`1`)。加算した後の桁上がりを代入する。\n
+     * \return 計算した和の下位64ビット。\n
+     */
+    uint64_t add_with_carry
+        (const uint64_t& lhs, const uint64_t& rhs, uint64_t*const car);
+
+    /*!\brief 桁借りを伴って減算する。
+     * \param lhs 被減数。\n
+     * \param rhs 減数。\n
+     * \param bor 桁借り(`0`か`1`)。減算した後の桁借りを代入する。\n
+     * \return 計算した差の下位64ビット。\n
+     */
+    uint64_t subtract_with_borrow
+        (const uint64_t& lhs, const uint64_t& rhs, uint64_t*const bor);
+
+    /*!\brief 桁上がりを伴って乗算し、加算する。
+     *
+     * `lhs * rhs + add + *car`を128ビットで計算する。\n
+     * 結果は必ず128ビットに収まる。\n
+     * \param lhs 被乗数。\n
+     * \param rhs 乗数。\n
+     * \param add 加数。\n
+     * \param car 桁上がり。計算した結果の上位64ビットを代入する。\n
+     * \return 計算した結果の下位64ビット。\n
+     */
+    uint64_t multiply_with_carry(
+        const uint64_t& lhs,
+        const uint64_t& rhs,
+        const uint64_t& add,
+        uint64_t*const car
+    );
+
+    /*!\brief 128ビットの被除数を64ビットの除数で除算する。
+     * \param hig 被除数の上位64ビット。\n
+     * \param low 被除数の下位64ビット。\n
+     * \param div 除数。\n
+     * \param rem 剰余を代入する。`nullptr`なら代入しない。\n
+     * \return 計算した商。\n
+     * \warning `hig`は`div`未満でなければならない。\n
+     */
+    uint64_t divide_with_remainder(
+        const uint64_t& hig,
+        const uint64_t& low,
+        const uint64_t& div,
+        uint64_t*const rem
+    );
+
+    /*!\brief フィールドの配列に64ビットの値を乗算し、加算する。
+     *
+     * 基数変換で複数の桁をまとめて取り込むときに使う。\n
+     * `len`個のフィールドに収まらない上位の部分は捨てる。\n
+     * \param num フィールドの配列。結果を代入する。\n
+     * \param len `num`のフィールドの数。\n
+     * \param mul 乗数。\n
+     * \param add 加数。\n
+     */
+    void multiply_add_fields(
+        uint64_t*const num,
+        const size_t& len,
+        const uint64_t& mul,
+        const uint64_t& add
+    );
+
+    /*!\brief フィールドの配列を64ビットの値で除算する。
+     *
+     * 基数変換で複数の桁をまとめて取り出すときに使う。\n
+     * \param num フィールドの配列。商を代入する。\n
+     * \param len `num`のフィールドの数。\n
+     * \param div 除数。\n
+     * \return 計算した剰余。\n
+     * \warning `div`は非`0`でなければならない。\n
+     */
+    uint64_t divide_fields
+        (uint64_t*const num, const size_t& len, const uint64_t& div);
+
+    /*!\brief バイト列をフィールドの配列に変換する。
+     *
+     * 8バイトずつ`std::memcpy`で読み込み、バイトオーダーが異なれば<!--
+     * -->バイトを入れ替える。\n
+     * `len`個のフィールドに収まらない上位の部分は捨て、足りない上位<!--
+     * -->の部分は`0`とする。\n
+     * \param fies フィールドの配列。結果を代入する。\n
+     * \param len `fies`のフィールドの数。\n
+     * \param byts バイト列。\n
+     * \param siz `byts`の大きさ(バイト長)。\n
+     * \param ord バイトオーダー。ビッグエンディアンなら真、リトルエ<!--
+     * -->ンディアンなら偽。\n
+     */
+    void bytes_to_fields(
+        uint64_t*const fies,
+        const size_t& len,
+        const uint8_t*const byts,
+        const size_t& siz,
+        const bool& ord
+    );
+
+    /*!\brief フィールドの配列をバイト列に変換する。
+     *
+     * 8バイトずつバイトオーダーを合わせ、`std::memcpy`で書き込む。\n
+     * `siz`バイトに収まらない上位の部分は捨て、足りない上位の部分は<!--
+     * -->`0`とする。\n
+     * \param fies フィールドの配列。\n
+     * \param len `fies`のフィールドの数。\n
+     * \param byts バイト列。結果を代入する。\n
+     * \param siz `byts`の大きさ(バイト長)。\n
+     * \param ord バイトオーダー。ビッグエンディアンなら真、リトルエ<!--
+     * -->ンディアンなら偽。\n
+     */
+    void fields_to_bytes(
+        const uint64_t*const fies,
+        const size_t& len,
+        uint8_t*const byts,
+        const size_t& siz,
+        const bool& ord
+    );
+
+    /*!\brief フィールドの配列同士を乗算する。
+     * \param lhs 被乗数のフィールドの配列。\n
+     * \param rhs 乗数のフィールドの配列。\n
+     * \param len `lhs`と`rhs`のフィールドの数。\n
+     * \param pro 積を代入する`2 * len`個のフィールドの配列。\n
+     */
+    void multiply_fields(
+        const uint64_t*const lhs,
+        const uint64_t*const rhs,
+        const size_t& len,
+        uint64_t*const pro
+    );
+
+    /*!\brief フィールドの配列を2乗する。
+     *
+     * 異なるフィールド同士の積を1回ずつ計算して2倍し、同じフィール<!--
+     * -->ド同士の積を加算する。\n
+     * 部分積の数は`ecc::multiply_fields`のおよそ半分になる。\n
+     * \param num フィールドの配列。\n
+     * \param len `num`のフィールドの数。\n
+     * \param pro 2乗を代入する`2 * len`個のフィールドの配列。\n
+     */
+    void square_fields
+        (const uint64_t*const num, const size_t& len, uint64_t*const pro);
+
+    /*!\brief 部分積を3フィールドの累算器に加算する。
+     * \param lhs 被乗数。\n
+     * \param rhs 乗数。\n
+     * \param acc 下位から順に並んだ3個のフィールドの累算器。\n
+     */
+    void multiply_accumulate
+        (const uint64_t& lhs, const uint64_t& rhs, uint64_t*const acc);
+
+    /*!\brief 積の1個のフィールドに寄与する部分積を累算器に加算する。
+     * \tparam N `lhs`と`rhs`のフィールドの数。\n
+     * \tparam K 積のフィールドの位置。\n
+     * \tparam IS 加算する部分積の番号の列。\n
+     * \param lhs 被乗数のフィールドの配列。\n
+     * \param rhs 乗数のフィールドの配列。\n
+     * \param acc 3個のフィールドの累算器。\n
+     */
+    template <size_t N, size_t K, size_t... IS> void multiply_column(
+        const uint64_t*const lhs,
+        const uint64_t*const rhs,
+        uint64_t*const acc,
+        std::index_sequence<IS...>
+    );
+
+    /*!\brief 積のフィールドを下位から順に計算する。
+     * \tparam N `lhs`と`rhs`のフィールドの数。\n
+     * \tparam KS 計算する積のフィールドの位置の列。\n
+     * \param lhs 被乗数のフィールドの配列。\n
+     * \param rhs 乗数のフィールドの配列。\n
+     * \param pro 積を代入するフィールドの配列。\n
+     */
+    template <size_t N, size_t... KS> void multiply_columns(
+        const uint64_t*const lhs,
+        const uint64_t*const rhs,
+        uint64_t*const pro,
+        std::index_sequence<KS...>
+    );
+
+    /*!\brief フィールドの数が決まった配列同士を列ごとに乗算する。
+     *
+     * 積のフィールドごとに、寄与する部分積をすべて累算器に加算してから<!--
+     * -->書き出す(Comba法)。\n
+     * 繰り返しはコンパイル時に展開され、値による分岐を含まない。\n
+     * \tparam N `lhs`と`rhs`のフィールドの数。\n
+     * \tparam L 計算する積の下位のフィールドの数。`2 * N`以下。\n
+     * \param lhs 被乗数のフィールドの配列。\n
+     * \param rhs 乗数のフィールドの配列。\n
+     * \param pro 積の下位`L`個を代入するフィールドの配列。\n
+     */
+    template <size_t N, size_t L = 2 * N> void multiply_fields(
+        const uint64_t*const lhs,
+        const uint64_t*const rhs,
+        uint64_t*const pro
+    );
+
+    /*!\brief Karatsuba法に切り替えるフィールドの数の下限。
+     *
+     * フィールドの数がこれ未満なら`ecc::multiply_fields`で乗算する。\n
+     * 64ビットのフィールドではComba法の部分積が安いので、2048ビット<!--
+     * -->未満ではKaratsuba法の加減算の手間が上回る。\n
+     */
+    constexpr size_t KARATSUBA_THRESHOLD = 32;
+
+    /*!\brief フィールドの配列同士をKaratsuba法で乗算する。
+     *
+     * 上位と下位に分けた半分の長さの乗算3回に帰着させる。\n
+     * フィールドの数が`T`未満になったら`ecc::multiply_fields`で乗算<!--
+     * -->する。\n
+     * \tparam N `lhs`と`rhs`のフィールドの数。\n
+     * \tparam L 計算する積の下位のフィールドの数。`2 * N`以下。\n
+     * \tparam T Karatsuba法に切り替えるフィールドの数の下限。\n
+     * \param lhs 被乗数のフィールドの配列。\n
+     * \param rhs 乗数のフィールドの配列。\n
+     * \param pro 積の下位`L`個を代入するフィールドの配列。\n
+     */
+    template <
+        size_t N,
+        size_t L = 2 * N,
+        size_t T = KARATSUBA_THRESHOLD
+    > void multiply_fields_karatsuba(
+        const uint64_t*const lhs,
+        const uint64_t*const rhs,
+        uint64_t*const pro
+    );
+
+    /*!\brief フィールドの数が少ない配列同士を乗算する。
+     * \param lhs 被乗数のフィールドの配列。\n
+     * \param rhs 乗数のフィールドの配列。\n
+     * \param pro 積の下位`L`個を代入するフィールドの配列。\n
+     * \param kar Karatsuba法を使うか。\n
+     */
+    template <size_t N, size_t L, size_t T> void multiply_fields_karatsuba(
+        const uint64_t*const lhs,
+        const uint64_t*const rhs,
+        uint64_t*const pro,
+        std::false_type kar
+    );
+
+    /*!\brief フィールドの数が多い配列同士を乗算する。
+     * \param lhs 被乗数のフィールドの配列。\n
+     * \param rhs 乗数のフィールドの配列。\n
+     * \param pro 積の下位`L`個を代入するフィールドの配列。\n
+     * \param kar Karatsuba法を使うか。\n
+     */
+    template <size_t N, size_t L, size_t T> void multiply_fields_karatsuba(
+        const uint64_t*const lhs,
+        const uint64_t*const rhs,
+        uint64_t*const pro,
+        std::true_type kar
+    );
+
+    /*!\brief フィールドの配列を演算するカーネルの表。
+     *
+     * フィールドの数が実行時に決まる乗算、2乗、モンゴメリ還元はこの表<!--
+     * -->を経由して呼ばれる。\n
+     * 表は起動時にCPUの機能を調べて`ecc::select_kernels`で選ばれる。\n
+     */
+    struct field_kernels {
+        //!\brief 表の名前。`"generic"`か`"bmi2_adx"`である。
+        const char* name;
+
+        //!\brief `ecc::multiply_fields`と同じ結果を計算する関数。
+        void (*multiply)(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const size_t& len,
+            uint64_t*const pro
+        );
+
+        //!\brief `ecc::square_fields`と同じ結果を計算する関数。
+        void (*square)
+            (const uint64_t*const num, const size_t& len, uint64_t*const pro);
+
+        /*!\brief モンゴメリ乗算する関数。
+         *
+         * `lhs * rhs * R^-1`を`ord`の2倍未満の`len + 1`個のフィールドと<!--
+         * -->して`res`に代入する。\n
+         * `res`には`len + 2`個のフィールドが必要である。\n
+         */
+        void (*montgomery_multiply)(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const uint64_t*const ord,
+            const size_t& len,
+            const uint64_t& negInv,
+            uint64_t*const res
+        );
+
+        /*!\brief モンゴメリ還元する関数。
+         *
+         * `2 * len + 1`個のフィールドの`num`を還元し、`num * R^-1`を<!--
+         * -->`ord`の2倍未満の`len + 1`個のフィールドとして`num + len`に<!--
+         * -->残す。\n
+         */
+        void (*montgomery_reduce)(
+            uint64_t*const num,
+            const uint64_t*const ord,
+            const size_t& len,
+            const uint64_t& negInv
+        );
+    };
+
+    /*!\brief 複数の多倍長整数を並列に演算するカーネルの表。
+     *
+     * 数は32ビットの桁に分けられ、`len`個の桁の行に`lan`個のレーンを<!--
+     * -->並べた配列として渡される。\n
+     * `i`番目のレーンの`j`番目の桁は`[j * lan + i]`にあり、64ビットの<!--
+     * -->フィールドの下位32ビットに格納される。\n
+     * `ord`は全レーンで共通の法の桁の配列である。\n
+     * 引数の配列と`res`は重なってはならない。\n
+     */
+    struct batch_kernels {
+        //!\brief 表の名前。`"generic"`か`"avx2"`である。
+        const char* name;
+
+        //!\brief `2^(32 * len)`を法として加算する関数。
+        void (*add)(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const size_t& len,
+            const size_t& lan,
+            uint64_t*const res
+        );
+
+        //!\brief `2^(32 * len)`を法として減算する関数。
+        void (*subtract)(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const size_t& len,
+            const size_t& lan,
+            uint64_t*const res
+        );
+
+        //!\brief `2^(32 * len)`を法として乗算する関数。
+        void (*multiply)(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const size_t& len,
+            const size_t& lan,
+            uint64_t*const res
+        );
+
+        //!\brief `ord`未満の数同士を`ord`を法として加算する関数。
+        void (*add_modulo)(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const uint64_t*const ord,
+            const size_t& len,
+            const size_t& lan,
+            uint64_t*const res
+        );
+
+        //!\brief `ord`未満の数同士を`ord`を法として減算する関数。
+        void (*subtract_modulo)(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const uint64_t*const ord,
+            const size_t& len,
+            const size_t& lan,
+            uint64_t*const res
+        );
+
+        /*!\brief モンゴメリ乗算する関数。
+         *
+         * `ord`未満の数同士の`lhs * rhs * 2^(-32 * len)`を`ord`を法と<!--
+         * -->して計算する。\n
+         * `negInv`は`-ord^-1`を`2^32`を法としたものである。\n
+         * `tmp`には`4 * (len + 2)`個のフィールドが必要である。\n
+         * 32ビットの桁ではレーンごとの64ビットの乗算より遅くなるので、<!--
+         * -->汎用の表では`nullptr`となる。\n
+         */
+        void (*montgomery_multiply)(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            const uint64_t*const ord,
+            const size_t& len,
+            const uint64_t& negInv,
+            const size_t& lan,
+            uint64_t*const res,
+            uint64_t*const tmp
+        );
+    };
+
+    /*!\brief 現在のカーネルの表を取得する。
+     * \return 取得したカーネルの表。\n
+     */
+    const field_kernels& kernels();
+
+    /*!\brief 現在の並列演算のカーネルの表を取得する。
+     * \return 取得したカーネルの表。\n
+     */
+    const batch_kernels& kernels_for_batch();
+
+    /*!\brief CPUとOSがAVX2に対応しているかどうかを判定する。
+     *
+     * x86-64以外では常に偽となる。\n
+     * \return 対応していれば真、していなければ偽。\n
+     */
+    bool supports_avx2();
+
+    /*!\brief CPUがBMI2とADXに対応しているかどうかを判定する。
+     *
+     * x86-64以外では常に偽となる。\n
+     * \return 対応していれば真、していなければ偽。\n
+     */
+    bool supports_bmi2_adx();
+
+    /*!\brief カーネルの表を選ぶ。
+     *
+     * 起動時に`gen`を偽として1回呼ばれる。\n
+     * 並列演算のカーネルの表も同時に選ぶ。\n
+     * テストで汎用のカーネルと比べるときは`gen`を真として呼ぶ。\n
+     * \param gen 汎用のカーネルに固定するかどうかのフラグ。\n
+     * \return 選んだカーネルの表。\n
+     * \warning 他のスレッドが素体を使っている間に呼んではならない。\n
+     */
+    const field_kernels& select_kernels(const bool& gen);
+
+    void montgomery_multiply_generic(
+        const uint64_t*const lhs,
+        const uint64_t*const rhs,
+        const uint64_t*const ord,
+        const size_t& len,
+        const uint64_t& negInv,
+        uint64_t*const res
+    );
+    void montgomery_reduce_generic(
+        uint64_t*const num,
+        const uint64_t*const ord,
+        const size_t& len,
+        const uint64_t& negInv
+    );
+    void multiply_fields_generic(
+        const uint64_t*const lhs,
+        const uint64_t*const rhs,
+        const size_t& len,
+        uint64_t*const pro
+    );
+    void square_fields_generic
+        (const uint64_t*const num, const size_t& len, uint64_t*const pro);
+#if defined(__x86_64__) && defined(__GNUC__)
+    void montgomery_multiply_bmi2_adx(
+        const uint64_t*const lhs,
+        const uint64_t*const rhs,
+        const uint64_t*const ord,
+        const size_t& len,
+        const uint64_t& negInv,
+        uint64_t*const res
+    );
+    void montgomery_reduce_bmi2_adx(
+        uint64_t*const num,
+        const uint64_t*const ord,
+        const size_t& len,
+        const uint64_t& negInv
+    );
+    void multiply_fields_bmi2_adx(
+        const uint64_t*const lhs,
+        const uint64_t*const rhs,
+        const size_t& len,
+        uint64_t*const pro
+    );
+    void square_fields_bmi2_adx
+        (const uint64_t*const num, const size_t& len, uint64_t*const pro);
+#endif
+
+    /*!\brief 多倍長整数を2乗する。
+     *
+     * `num * num`と同じ結果になるが、`ecc::square_fields`を使うので<!--
+     * -->速い。\n
+     * \param num 多倍長整数。\n
+     * \return 計算した2乗。\n
+     */
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        square(const big_int<S, C, W, U>& num);
+
+    /*!\brief 乗算し、積を広い記憶領域の多倍長整数として取得する。
+     * \param lhs 被乗数。\n
+     * \param rhs 乗数。\n
+     * \return 計算した積。\n
+     */
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, true, U>
+        multiply_wide
+            (const big_int<S, C, W, U>& lhs, const big_int<S, C, W, U>& rhs);
+
+    /*!\brief 剰余を計算し、狭い記憶領域の多倍長整数として取得する。
+     * \tparam U_ 法の符号なしのフラグ。\n
+     * \param num 被除数。\n
+     * \param mod 法。\n
+     * \return 計算した剰余。必ず`0`以上、`mod`未満となる。\n
+     * \warning `mod`は正でなければならない。\n
+     */
+    template <size_t S, bool C, bool W, bool U, bool U_>
+        big_int<S, C, false, U_> reduce_wide(
+            const big_int<S, C, W, U>& num,
+            const big_int<S, C, false, U_>& mod
+        );
+
+    /*!\brief 法に関する逆数を計算する。
+     *
+     * 2進拡張ユークリッド互除法を固定長のフィールドの配列の上で繰り返<!--
+     * -->す。\n
+     * 除算も再帰もしないので、`ecc::gcdm`よりはるかに速い。\n
+     * \param num 逆数を求める整数。\n
+     * \param mod 法。\n
+     * \return 計算した逆数。必ず`0`以上、`mod`未満となる。\n
+     * `num`と`mod`が互いに素でなければ`0`となる。\n
+     * \warning `num`は`0`以上、`mod`未満でなければならない。\n
+     * \warning `mod`は正の奇数でなければならない。\n
+     */
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        invert_modulo
+            (const big_int<S, C, W, U>& num, const big_int<S, C, W, U>& mod);
+
+    /*!\brief 法に関する和を計算する。
+     *
+     * 和から法を引いた差を求め、桁借りのマスクで和と差のどちらかを選<!--
+     * -->ぶ。\n
+     * 除算も分岐もしない。\n
+     * \param lhs 被加数。\n
+     * \param rhs 加数。\n
+     * \param mod 法。\n
+     * \return 計算した和。必ず`0`以上、`mod`未満となる。\n
+     * \warning `lhs`と`rhs`は`0`以上、`mod`未満でなければならない。\n
+     */
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        add_modulo(
+            const big_int<S, C, W, U>& lhs,
+            const big_int<S, C, W, U>& rhs,
+            const big_int<S, C, W, U>& mod
+        );
+
+    /*!\brief 法に関する差を計算する。
+     *
+     * 差が負なら、桁借りのマスクで選んだ法を足す。\n
+     * 除算も分岐もしない。\n
+     * \param lhs 被減数。\n
+     * \param rhs 減数。\n
+     * \param mod 法。\n
+     * \return 計算した差。必ず`0`以上、`mod`未満となる。\n
+     * \warning `lhs`と`rhs`は`0`以上、`mod`未満でなければならない。\n
+     */
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        subtract_modulo(
+            const big_int<S, C, W, U>& lhs,
+            const big_int<S, C, W, U>& rhs,
+            const big_int<S, C, W, U>& mod
+        );
+
+    /*!\brief 法に関して半分にする。
+     *
+     * 奇数なら、最下位ビットのマスクで選んだ法を足してから右に1ビッ<!--
+     * -->トシフトする。\n
+     * 除算も分岐もしない。\n
+     * \param num 整数。\n
+     * \param mod 法。\n
+     * \return 計算した値。2倍すると`num`と合同になる。\n
+     * \warning `num`は`0`以上、`mod`未満でなければならない。\n
+     * \warning `mod`は正の奇数でなければならない。\n
+     */
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        halve_modulo
+            (const big_int<S, C, W, U>& num, const big_int<S, C, W, U>& mod);
+
+    /*!\brief 剰余を保持するための狭い型を定める。
+     *
+     * 組み込み整数型ならその型のままである。\n
+     * \tparam V 値の型。\n
+     */
+    template <typename V> struct narrow {
+        //!\brief 狭い型。
+        using type = V;
+    };
+
+    /*!\brief 剰余を保持するための狭い型を定める。
+     *
+     * `ecc::big_int`なら狭い記憶領域の符号なしの`ecc::big_int`である。\n
+     * 剰余は負にならないので、符号の処理を省くことができる。\n
+     */
+    template <size_t S, bool C, bool W, bool U>
+        struct narrow<big_int<S, C, W, U>>
+    {
+        //!\brief 狭い型。
+        using type = big_int<S, C, false, true>;
+    };
+
+    /*!\brief 積の和を保持するための広い型を定める。
+     *
+     * 組み込み整数型ならその型のままである。\n
+     * \tparam V 値の型。\n
+     */
+    template <typename V> struct wide {
+        //!\brief 広い型。
+        using type = V;
+    };
+
+    /*!\brief 積の和を保持するための広い型を定める。
+     *
+     * `ecc::big_int`なら広い記憶領域の符号なしの`ecc::big_int`である。\n
+     * 狭い型の積を収めても余るフィールドに、複数の積の和の桁上がりを<!--
+     * -->収めることができる。\n
+     */
+    template <size_t S, bool C, bool W, bool U>
+        struct wide<big_int<S, C, W, U>>
+    {
+        //!\brief 広い型。
+        using type = big_int<S, C, true, true>;
+    };
+
+    template <size_t S, bool C, bool W, bool U>
+        size_t capacity_of_products(const big_int<S, C, W, U>& mod);
+
+    template <size_t S, bool C, bool W, bool U> constexpr size_t
+        LOGICAL_SIZE_OF_SPECIALIZED(const big_int<S, C, W, U>& val);
+    template <size_t S, bool O, size_t Z, bool C, bool W, bool U>
+        big_int<Z, C, W, U>
+        bytes_to_number_specialized
+            (const big_int<Z, C, W, U>&, const uint8_t*const byts);
+    template <size_t S, bool O, size_t Z, bool C, bool W, bool U>
+        void number_to_bytes_specialized
+            (const big_int<Z, C, W, U>& num, uint8_t*const byts);
+
+    //@}
+
+    //---- helper declaration ----
+
+    /*!\defgroup mhelper 補助
+     * このモジュールには`eccrypto`ライブラリの使用を補助するための機<!--
+     * -->能が含まれる。\n
+     @{*/
+
+    /*!\brief 値オブジェクトを構築するファクトリーを表す。
+     *
+     * 値オブジェクトを構築する際に生成源となるオブジェクトを渡す。\n
+     * \tparam V 値オブジェクトの型。\n
+     * \tparam G 生成源の型。\n
+     */
+    template <typename V, class G> class factory {
+    public:
+        /*!\brief インスタンスを構築する。
+         * \param gen 生成源。\n
+         */
+        factory(G*const gen);
 
         /*!\brief 生成源から値オブジェクトを構築する。
          *
@@ -2524,7 +4611,7 @@ namespace ecc {
         V bytes_to_number(const get_byte& getByt);
 
     template <size_t S, bool O, typename V> V
-        bytes_to_number_specialized(const V& val, const get_byte& getByt);
+        bytes_to_number_specialized(const V&, const uint8_t*const byts);
 
     /*!\brief バイト列を整数列に変換する処理関数を作る。
      * \tparam V 整数の型。\n
@@ -2536,6 +4623,26 @@ namespace ecc {
     template <typename V, size_t S = LOGICAL_SIZE_OF<V>(), bool O = true>
         byte_to_number<V> bytes_to_numbers();
 
+    /*!\brief メモリ上のバイト列をまとめて整数列に変換する。
+     *
+     * `std::function`を介さないので、処理関数を連結するよりも速い。\n
+     * \code
+     * uint8_t byts[40] = {...};
+     * ecc::big_int<20> nums[2];
+     * ecc::bytes_to_numbers<ecc::big_int<20>>(byts, 2, nums);
+     * \endcode
+     * \tparam V 整数の型。\n
+     * \tparam S 整数の大きさ(バイト長)。既定値は論理的な大きさ。\n
+     * \tparam O バイトオーダー。ビッグエンディアンなら真、リトルエン<!--
+     * -->ディアンなら偽。既定値は真。\n
+     * \param byts バイト列。`S * cou`バイトでなければならない。\n
+     * \param cou 整数の数。\n
+     * \param nums 整数列。結果を代入する。\n
+     */
+    template <typename V, size_t S = LOGICAL_SIZE_OF<V>(), bool O = true>
+        void bytes_to_numbers
+            (const uint8_t*const byts, const size_t& cou, V*const nums);
+
     /*!\brief 型変換する処理関数を作る。
      * \tparam I 入力するデータ片の型。\n
      * \tparam O 出力するデータ片の型。\n
@@ -2552,8 +4659,29 @@ namespace ecc {
         (const std::string& sep, std::ostream& os, L&& lea, TS&& ...tras);
     template <typename V> auto doubling(const V& val) ->
         decltype(val+val);
+    template <typename T, typename E, class M, class Q> T exponentiate(
+        const T& bas,
+        const E& exp,
+        const T& one,
+        const M& mul,
+        const Q& squ
+    );
+    template <typename T, size_t N, class M, class Q>
+        T exponentiate_with_chain(
+            const T& bas,
+            const addition_chain_step (&cha)[N],
+            const M& mul,
+            const Q& squ
+        );
     template <typename V> V fit_within_range
         (const V& num, const V& min, const V& max);
+    template <size_t N> void fold_pseudo_mersenne(
+        uint64_t*const num,
+        const size_t& lenOfBit,
+        const uint64_t*const dif,
+        const size_t& lenOfDif,
+        const uint64_t*const ord
+    );
     template <typename V> V gcdm
         (const V& a, const V& b, V*const x, V*const y);
     template <typename V> V gcdm(
@@ -2624,8 +4752,7 @@ namespace ecc {
         void number_to_bytes(const V& num, const put_byte& putByt);
 
     template <size_t S, bool O, typename V>
-        void number_to_bytes_specialized
-            (const V& num, const put_byte& putByt);
+        void number_to_bytes_specialized(const V& num, uint8_t*const byts);
 
     /*!\brief 整数列をバイト列に変換する処理関数を作る。
      * \tparam V 整数の型。\n
@@ -2637,6 +4764,21 @@ namespace ecc {
     template <typename V, size_t S = LOGICAL_SIZE_OF<V>(), bool O = true>
         number_to_byte<V> numbers_to_bytes();
 
+    /*!\brief 整数列をまとめてメモリ上のバイト列に変換する。
+     *
+     * `std::function`を介さないので、処理関数を連結するよりも速い。\n
+     * \tparam V 整数の型。\n
+     * \tparam S 整数の大きさ。既定値は論理的な大きさ。\n
+     * \tparam O バイトオーダー。ビッグエンディアンなら真、リトルエン<!--
+     * -->ディアンなら偽。既定値は真。\n
+     * \param nums 整数列。\n
+     * \param cou 整数の数。\n
+     * \param byts `S * cou`バイトのバイト列。結果を代入する。\n
+     */
+    template <typename V, size_t S = LOGICAL_SIZE_OF<V>(), bool O = true>
+        void numbers_to_bytes
+            (const V*const nums, const size_t& cou, uint8_t*const byts);
+
     /*!\brief 値オブジェクトの入力関数から引数なしメンバの入力関数に変<!--
      * -->換する。
      *
@@ -2667,74 +4809,758 @@ namespace ecc {
         V(O::*const mem)() const
     );
 
-    template <typename V> auto square(const V& val) -> decltype(val*val);
-    template <typename V> value_to_value<V, V> through();
+    /*!\brief 法に関する累乗を計算する。
+     *
+     * `ecc::pow`と同じくスライディングウィンドウ法で計算する。\n
+     * 素体を構築するまでもない計算(素数判定など)に使う。\n
+     * \param num 底。\n
+     * \param exp 指数。\n
+     * \param mod 法。\n
+     * \return 計算した累乗。必ず`0`以上、`mod`未満となる。\n
+     * \warning `num`は`0`以上、`mod`未満でなければならない。\n
+     * \warning `exp`は`0`以上でなければならない。\n
+     * \warning `mod`は正で、`V`は`mod`の2乗を表せなければならない。\n
+     */
+    template <typename V> V pow_modulo
+        (const V& num, const V& exp, const V& mod);
+
+    template <typename V> V add_modulo
+        (const V& lhs, const V& rhs, const V& mod);
+    template <typename V> size_t capacity_of_products(const V& mod);
+    template <typename V> V subtract_modulo
+        (const V& lhs, const V& rhs, const V& mod);
+    template <typename V> V halve_modulo(const V& num, const V& mod);
+    template <typename V> V invert_modulo(const V& num, const V& mod);
+    template <typename V> V multiply_wide(const V& lhs, const V& rhs);
+    template <typename V> V reduce_wide(const V& num, const V& mod);
+    template <typename V> auto square(const V& val) -> decltype(val*val);
+    template <typename V> value_to_value<V, V> through();
+
+    int base_to_radix(const std::ios::fmtflags& bas);
+    int bits_to_byte(const get_bit& getBit);
+
+    /*!\brief ビット列をバイト列に変換する処理関数を作る。
+     * \return 作った処理関数。\n
+     */
+    bit_to_byte bits_to_bytes();
+
+    void byte_to_bits(const int& byt, const put_bit& putBit);
+
+    /*!\brief バイト列をビット列に変換する処理関数を作る。
+     * \return 作った処理関数。\n
+     */
+    byte_to_bit bytes_to_bits();
+
+    int letter_to_digit(const int& let);
+
+    /*!\brief 入力ストリームからバイト列の入力関数を作る。
+     *
+     * 入力関数はEOFに達すると`ecc::eof_exception`をスローする。\n
+     * \param is 入力ストリーム。\n
+     * \return 作った入力関数。\n
+     */
+    get_byte make_getter_from_istream(std::istream& is);
+
+    /*!\brief 出力ストリームからバイト列の出力関数を作る。
+     *
+     * \param io 出力ストリーム。\n
+     * \return 作った出力関数。\n
+     */
+    put_byte make_putter_from_ostream(std::ostream& os);
+
+    //@}
+
+    //---- ecurve definition ----
+
+    template <typename V> PrimeField<V>::PrimeField(const V& ord) :
+        ord_(ord),
+        acc_cap_(capacity_of_products(ord_)),
+        leg_exp_((ord - V(1)) / V(2)),
+        roo_exp_(0),
+        odd_par_(ord - V(1)),
+        non_pow_(0),
+        two_adi_(0)
+    {
+        if (!odd_par_) return;
+        for (; !(odd_par_ % V(2)); ++two_adi_) odd_par_ = odd_par_ / V(2);
+        if (two_adi_ == 1) roo_exp_ = (ord + V(1)) / V(4);
+        else if (two_adi_ == 2) roo_exp_ = (ord - V(5)) / V(8);
+        else if (two_adi_ > 2) {
+            // 構築中なので、仮想関数はこのクラスの演算として呼ばれる。
+            roo_exp_ = (odd_par_ + V(1)) / V(2);
+            V non(2);
+            while (is_square(encode(non))) non = non + V(1);
+            non_pow_ = decode(power(encode(non), odd_par_));
+        }
+    }
+
+    template <typename V> V PrimeField<V>::order() {
+        return V(ord_);
+    }
+
+    template <typename V> typename PrimeField<V>::residue
+        PrimeField<V>::encode(const V& val)
+    {
+        return reduce_wide(val, ord_);
+    }
+
+    template <typename V> V PrimeField<V>::decode(const residue& val) {
+        return V(val);
+    }
+
+    template <typename V> typename PrimeField<V>::residue
+        PrimeField<V>::multiply(const residue& lhs, const residue& rhs)
+    {
+        return reduce_wide(multiply_wide(lhs, rhs), ord_);
+    }
+
+    template <typename V> typename PrimeField<V>::residue
+        PrimeField<V>::square(const residue& val)
+    {
+        return reduce_wide(multiply_wide(val, val), ord_);
+    }
+
+    template <typename V> typename PrimeField<V>::residue
+        PrimeField<V>::invert(const residue& val)
+    {
+        return invert_modulo(val, ord_);
+    }
+
+    template <typename V> typename PrimeField<V>::residue
+        PrimeField<V>::reduce(const residue& val)
+    {
+        residue res = val % ord_;
+        if (res < residue(0)) res += ord_;
+        return res;
+    }
+
+    template <typename V> typename PrimeField<V>::residue
+        PrimeField<V>::add(const residue& lhs, const residue& rhs)
+    {
+        return add_modulo(lhs, rhs, ord_);
+    }
+
+    template <typename V> typename PrimeField<V>::residue
+        PrimeField<V>::subtract(const residue& lhs, const residue& rhs)
+    {
+        return subtract_modulo(lhs, rhs, ord_);
+    }
+
+    template <typename V> bool PrimeField<V>::equal
+        (const residue& lhs, const residue& rhs)
+    {
+        return lhs == rhs;
+    }
+
+    template <typename V> typename PrimeField<V>::residue
+        PrimeField<V>::halve(const residue& val)
+    {
+        return halve_modulo(val, ord_);
+    }
+
+    template <typename V> typename PrimeField<V>::residue
+        PrimeField<V>::power(const residue& val, const V& exp)
+    {
+        return exponentiate(
+            val,
+            exp,
+            encode(V(1)),
+            [this] (const residue& lhs, const residue& rhs) {
+                return multiply(lhs, rhs);
+            },
+            [this] (const residue& val) {
+                return square(val);
+            }
+        );
+    }
+
+    template <typename V> template <size_t N>
+        typename PrimeField<V>::residue PrimeField<V>::power
+            (const residue& val, const addition_chain_step (&cha)[N])
+    {
+        return exponentiate_with_chain(
+            val,
+            cha,
+            [this] (const residue& lhs, const residue& rhs) {
+                return multiply(lhs, rhs);
+            },
+            [this] (const residue& val) {
+                return square(val);
+            }
+        );
+    }
+
+    template <typename V> bool PrimeField<V>::is_square(const residue& val) {
+        return equal(val, encode(V(0))) ||
+            equal(power(val, leg_exp_), encode(V(1)));
+    }
+
+    template <typename V> typename PrimeField<V>::residue
+        PrimeField<V>::square_root(const residue& val)
+    {
+        if (!two_adi_) return val;
+        if (two_adi_ == 1) return power(val, roo_exp_);
+        const residue one = encode(V(1));
+        if (two_adi_ == 2) {
+            const residue
+                dbl = add(val, val),
+                b = power(dbl, roo_exp_),
+                i = multiply(dbl, square(b));
+            return multiply(multiply(val, b), subtract(i, one));
+        }
+        residue
+            c = encode(non_pow_),
+            t = power(val, odd_par_),
+            r = power(val, roo_exp_);
+        size_t m = two_adi_;
+        while (!equal(t, one)) {
+            size_t i = 0;
+            for (residue s = t; !equal(s, one); s = square(s)) {
+                if (++i == m) return subtract(val, val);
+            }
+            residue b = c;
+            for (size_t j = i + 1; j < m; ++j) b = square(b);
+            r = multiply(r, b);
+            c = square(b);
+            t = multiply(t, c);
+            m = i;
+        }
+        return r;
+    }
+
+    template <typename V> typename PrimeField<V>::residue
+        PrimeField<V>::to_lane(const residue& val)
+    {
+        return val;
+    }
+
+    template <typename V> typename PrimeField<V>::residue
+        PrimeField<V>::from_lane(const residue& val)
+    {
+        return val;
+    }
+
+    template <typename V> bool PrimeField<V>::multiply_lanes(
+        const uint64_t*const,
+        const uint64_t*const,
+        const size_t&,
+        uint64_t*const
+    ) {
+        return false;
+    }
+
+    template <typename V> typename PrimeField<V>::wide_residue
+        PrimeField<V>::widen(const residue& val)
+    {
+        return wide_residue(val);
+    }
+
+    template <typename V> typename PrimeField<V>::wide_residue
+        PrimeField<V>::multiply_unreduced
+            (const residue& lhs, const residue& rhs)
+    {
+        return multiply_wide(lhs, rhs);
+    }
+
+    template <typename V> typename PrimeField<V>::residue
+        PrimeField<V>::reduce_product(const wide_residue& val)
+    {
+        return reduce_wide(val, ord_);
+    }
+
+    template <typename V> MontgomeryField<V>::MontgomeryField
+        (const V& ord) : PrimeField<V>(ord)
+    {
+        const residue& o = this->ord_;
+        len_ = residue::NUMBER_OF_FIELDS;
+        while (len_ > 1 && !o[len_ - 1]) --len_;
+        uint64_t inv = o[0];
+        for (int i = 0; i < 5; ++i) inv *= 2 - o[0] * inv;
+        neg_inv_ = 0 - inv;
+        residue r(1);
+        const size_t lenOfBit = residue::LENGTH_OF_BITS_ON_FIELD * len_;
+        for (size_t i = 0; i < 2 * lenOfBit; ++i) {
+            r = doubling(r);
+            if (r >= o) r -= o;
+            if (i + 1 == lenOfBit) r1_ = r;
+        }
+        r2_ = r;
+        r3_ = multiply(r2_, r2_);
+        constexpr size_t BITS = residue::LENGTH_OF_BITS_ON_FIELD;
+        size_t lenOfOrd = lenOfBit;
+        while (!(o[(lenOfOrd - 1) / BITS] >> ((lenOfOrd - 1) % BITS) & 1))
+            --lenOfOrd;
+        const size_t cap = lenOfBit - lenOfOrd > 1 ?
+            size_t(1) << std::min(lenOfBit - lenOfOrd - 1, size_t(62)) : 2;
+        this->acc_cap_ = std::min(this->acc_cap_, cap);
+    }
+
+    template <typename V> typename MontgomeryField<V>::residue
+        MontgomeryField<V>::encode(const V& val)
+    {
+        return multiply(PrimeField<V>::encode(val), r2_);
+    }
+
+    template <typename V> V MontgomeryField<V>::decode(const residue& val) {
+        return V(multiply(val, residue(1)));
+    }
+
+    template <typename V> typename MontgomeryField<V>::residue
+        MontgomeryField<V>::multiply(const residue& lhs, const residue& rhs)
+    {
+        uint64_t t[residue::NUMBER_OF_FIELDS + 2];
+        kernels().montgomery_multiply
+            (&lhs[0], &rhs[0], &this->ord_[0], len_, neg_inv_, t);
+        return subtract_order(t);
+    }
+
+    template <typename V> typename MontgomeryField<V>::residue
+        MontgomeryField<V>::square(const residue& val)
+    {
+        const field_kernels& kers = kernels();
+        uint64_t t[2 * residue::NUMBER_OF_FIELDS + 1];
+        kers.square(&val[0], len_, t);
+        t[2 * len_] = 0;
+        kers.montgomery_reduce(t, &this->ord_[0], len_, neg_inv_);
+        return subtract_order(t + len_);
+    }
+
+    template <typename V> typename MontgomeryField<V>::residue
+        MontgomeryField<V>::invert(const residue& val)
+    {
+        return multiply(PrimeField<V>::invert(val), r3_);
+    }
+
+    template <typename V> bool MontgomeryField<V>::multiply_lanes(
+        const uint64_t*const lhs,
+        const uint64_t*const rhs,
+        const size_t& lan,
+        uint64_t*const pro
+    ) {
+        const batch_kernels& kers = kernels_for_batch();
+        if (!kers.montgomery_multiply) return false;
+        constexpr size_t N = 2 * residue::NUMBER_OF_FIELDS;
+        const size_t len = 2 * len_;
+        uint64_t ord[N], tmp[4 * (N + 2)];
+        for (size_t i = 0; i < len; ++i)
+            ord[i] = (this->ord_[i / 2] >> (32 * (i % 2))) & 0xffffffff;
+        kers.montgomery_multiply
+            (lhs, rhs, ord, len, neg_inv_ & 0xffffffff, lan, pro, tmp);
+        for (size_t i = len * lan; i < N * lan; ++i) pro[i] = 0;
+        return true;
+    }
+
+    template <typename V> typename MontgomeryField<V>::wide_residue
+        MontgomeryField<V>::widen(const residue& val)
+    {
+        return multiply_unreduced(val, r1_);
+    }
+
+    template <typename V> typename MontgomeryField<V>::wide_residue
+        MontgomeryField<V>::multiply_unreduced
+            (const residue& lhs, const residue& rhs)
+    {
+        constexpr size_t N = wide_residue::NUMBER_OF_FIELDS;
+        uint64_t t[2 * residue::NUMBER_OF_FIELDS];
+        kernels().multiply(&lhs[0], &rhs[0], len_, t);
+        wide_residue res(0);
+        for (size_t i = 0; i < 2 * len_ && i < N; ++i) res[i] = t[i];
+        return res;
+    }
+
+    template <typename V> typename MontgomeryField<V>::residue
+        MontgomeryField<V>::reduce_product(const wide_residue& val)
+    {
+        constexpr size_t N = wide_residue::NUMBER_OF_FIELDS;
+        uint64_t t[2 * residue::NUMBER_OF_FIELDS + 1];
+        for (size_t i = 0; i <= 2 * len_; ++i) t[i] = i < N ? val[i] : 0;
+        const residue& o = this->ord_;
+        kernels().montgomery_reduce(t, &o[0], len_, neg_inv_);
+        uint64_t dif[residue::NUMBER_OF_FIELDS + 1], bor = 0;
+        for (size_t i = 0; i < len_; ++i)
+            dif[i] = subtract_with_borrow(t[len_ + i], o[i], &bor);
+        dif[len_] = subtract_with_borrow(t[2 * len_], 0, &bor);
+        return subtract_order(bor ? t + len_ : dif);
+    }
+
+    template <typename V> typename MontgomeryField<V>::residue
+        MontgomeryField<V>::subtract_order(const uint64_t*const num)
+    {
+        const residue& o = this->ord_;
+        residue res(0);
+        uint64_t bor = 0;
+        for (size_t i = 0; i < len_; ++i)
+            res[i] = subtract_with_borrow(num[i], o[i], &bor);
+        subtract_with_borrow(num[len_], 0, &bor);
+        if (bor) {
+            for (size_t i = 0; i < len_; ++i) res[i] = num[i];
+        }
+        return res;
+    }
+
+    template <typename V, class K> SpecialPrimeField<V, K>::
+        SpecialPrimeField() : PrimeField<V>(make_order())
+    {
+        squ_ord_ = multiply_wide(this->ord_, this->ord_);
+    }
+
+    template <typename V, class K> typename SpecialPrimeField<V, K>::residue
+        SpecialPrimeField<V, K>::encode(const V& val)
+    {
+        residue res;
+        if (!fold(val, &res)) res = PrimeField<V>::encode(val);
+        return res;
+    }
+
+    template <typename V, class K> typename SpecialPrimeField<V, K>::residue
+        SpecialPrimeField<V, K>::multiply
+            (const residue& lhs, const residue& rhs)
+    {
+        constexpr size_t N = K::NUMBER_OF_FIELDS;
+        uint64_t pro[2 * N];
+        multiply_fields_karatsuba<N>(&lhs[0], &rhs[0], pro);
+        K::reduce(pro);
+        residue res(0);
+        for (size_t i = 0; i < N; ++i) res[i] = pro[i];
+        return res;
+    }
+
+    template <typename V, class K> typename SpecialPrimeField<V, K>::residue
+        SpecialPrimeField<V, K>::square(const residue& val)
+    {
+        constexpr size_t N = K::NUMBER_OF_FIELDS;
+        uint64_t pro[2 * N];
+        kernels().square(&val[0], N, pro);
+        K::reduce(pro);
+        residue res(0);
+        for (size_t i = 0; i < N; ++i) res[i] = pro[i];
+        return res;
+    }
+
+    template <typename V, class K> typename SpecialPrimeField<V, K>::residue
+        SpecialPrimeField<V, K>::reduce(const residue& val)
+    {
+        residue res;
+        if (!fold(val, &res)) res = PrimeField<V>::reduce(val);
+        return res;
+    }
+
+    template <typename V, class K>
+        typename SpecialPrimeField<V, K>::wide_residue
+        SpecialPrimeField<V, K>::multiply_unreduced
+            (const residue& lhs, const residue& rhs)
+    {
+        constexpr size_t N = K::NUMBER_OF_FIELDS;
+        uint64_t pro[2 * N];
+        multiply_fields_karatsuba<N>(&lhs[0], &rhs[0], pro);
+        wide_residue res(0);
+        for (size_t i = 0; i < 2 * N && i < wide_residue::NUMBER_OF_FIELDS; ++i)
+            res[i] = pro[i];
+        return res;
+    }
+
+    template <typename V, class K> typename SpecialPrimeField<V, K>::residue
+        SpecialPrimeField<V, K>::reduce_product(const wide_residue& val)
+    {
+        constexpr size_t N = K::NUMBER_OF_FIELDS;
+        constexpr size_t M = wide_residue::NUMBER_OF_FIELDS;
+        wide_residue num = val;
+        if (!(num < squ_ord_)) {
+            uint64_t hig[2 * N];
+            for (size_t i = 0; i < 2 * N; ++i)
+                hig[i] = i + 1 < M ? num[i + 1] : 0;
+            K::reduce(hig);
+            for (size_t i = 1; i < M; ++i) num[i] = i <= N ? hig[i - 1] : 0;
+        }
+        uint64_t fies[2 * N];
+        for (size_t i = 0; i < 2 * N; ++i) fies[i] = i < M ? num[i] : 0;
+        K::reduce(fies);
+        residue res(0);
+        for (size_t i = 0; i < N; ++i) res[i] = fies[i];
+        return res;
+    }
+
+    template <typename V, class K> template <typename T>
+        bool SpecialPrimeField<V, K>::fold
+            (const T& val, residue*const res)
+    {
+        constexpr size_t N = K::NUMBER_OF_FIELDS;
+        T num = val;
+        if (num < T(0)) num += T(this->ord_);
+        bool fit = !(num < T(0));
+        for (size_t i = 2 * N; fit && i < T::NUMBER_OF_FIELDS; ++i)
+            fit = !num[i];
+        if (fit) {
+            uint64_t fies[2 * N] = {};
+            for (size_t i = 0; i < 2 * N && i < T::NUMBER_OF_FIELDS; ++i)
+                fies[i] = num[i];
+            K::reduce(fies);
+            *res = residue(0);
+            for (size_t i = 0; i < N; ++i) (*res)[i] = fies[i];
+        }
+        return fit;
+    }
+
+    template <typename V, class K> typename SpecialPrimeField<V, K>::residue
+        SpecialPrimeField<V, K>::square_root(const residue& val)
+    {
+        return square_root(val, has_square_root_chain<K>());
+    }
+
+    template <typename V, class K> typename SpecialPrimeField<V, K>::residue
+        SpecialPrimeField<V, K>::square_root
+            (const residue& val, std::true_type)
+    {
+        return this->power(val, K::SQUARE_ROOT_CHAIN);
+    }
+
+    template <typename V, class K> typename SpecialPrimeField<V, K>::residue
+        SpecialPrimeField<V, K>::square_root
+            (const residue& val, std::false_type)
+    {
+        return PrimeField<V>::square_root(val);
+    }
+
+    template <typename V, class K> V SpecialPrimeField<V, K>::make_order() {
+        V ord(0);
+        for (size_t i = 0; i < K::NUMBER_OF_FIELDS; ++i) ord[i] = K::ORDER[i];
+        return ord;
+    }
+
+    template <typename V, class K> UnsaturatedField<V, K>::
+        UnsaturatedField() : PrimeField<V>(make_order())
+    {
+        static_assert(
+            residue::NUMBER_OF_FIELDS >= K::NUMBER_OF_LIMBS,
+            "the residue must have a field for each limb"
+        );
+        constexpr size_t N = K::NUMBER_OF_LIMBS;
+        ord_lim_ = split(this->ord_);
+        bia_ = residue(0);
+        for (size_t i = 0; i < N; ++i) bia_[i] = 4 * ord_lim_[i];
+        for (size_t i = 0; i + 1 < N; ++i) {
+            bia_[i] += uint64_t(1) << 52;
+            --bia_[i + 1];
+        }
+        const residue& o = this->ord_;
+        residue r(1);
+        for (size_t i = 0; i < 2 * K::LIMB_SHIFT; ++i) {
+            r = doubling(r);
+            if (r >= o) r -= o;
+        }
+        r2_ = split(r);
+        r3_ = multiply(r2_, r2_);
+        this->acc_cap_ = 32;
+    }
+
+    template <typename V, class K> typename UnsaturatedField<V, K>::residue
+        UnsaturatedField<V, K>::encode(const V& val)
+    {
+        const residue res = split(PrimeField<V>::encode(val));
+        return K::LIMB_SHIFT ? multiply(res, r2_) : res;
+    }
+
+    template <typename V, class K> V UnsaturatedField<V, K>::decode
+        (const residue& val)
+    {
+        return V(pack(K::LIMB_SHIFT ? multiply(val, residue(1)) : val));
+    }
+
+    template <typename V, class K> typename UnsaturatedField<V, K>::residue
+        UnsaturatedField<V, K>::multiply
+            (const residue& lhs, const residue& rhs)
+    {
+        const residue
+            l = weak(lhs) ? lhs : normalize(lhs),
+            r = weak(rhs) ? rhs : normalize(rhs);
+        residue res(0);
+        K::multiply_limbs(&l[0], &r[0], &res[0]);
+        return res;
+    }
+
+    template <typename V, class K> typename UnsaturatedField<V, K>::residue
+        UnsaturatedField<V, K>::square(const residue& val)
+    {
+        const residue v = weak(val) ? val : normalize(val);
+        residue res(0);
+        K::square_limbs(&v[0], &res[0]);
+        return res;
+    }
+
+    template <typename V, class K> typename UnsaturatedField<V, K>::residue
+        UnsaturatedField<V, K>::invert(const residue& val)
+    {
+        const residue res = split(PrimeField<V>::invert(pack(val)));
+        return K::LIMB_SHIFT ? multiply(res, r3_) : res;
+    }
+
+    template <typename V, class K> typename UnsaturatedField<V, K>::residue
+        UnsaturatedField<V, K>::reduce(const residue& val)
+    {
+        uint64_t bit = 0;
+        for (size_t i = 0; i < K::NUMBER_OF_LIMBS; ++i) bit |= val[i];
+        return bit >> 58 ? normalize(val) : val;
+    }
+
+    template <typename V, class K> typename UnsaturatedField<V, K>::residue
+        UnsaturatedField<V, K>::add(const residue& lhs, const residue& rhs)
+    {
+        return reduce(lhs + rhs);
+    }
+
+    template <typename V, class K> typename UnsaturatedField<V, K>::residue
+        UnsaturatedField<V, K>::halve(const residue& val)
+    {
+        return split(halve_modulo(pack(val), this->ord_));
+    }
 
-    int base_to_radix(const std::ios::fmtflags& bas);
-    int bits_to_byte(const get_bit& getBit);
+    template <typename V, class K> typename UnsaturatedField<V, K>::residue
+        UnsaturatedField<V, K>::square_root(const residue& val)
+    {
+        return this->power(val, K::SQUARE_ROOT_CHAIN);
+    }
 
-    /*!\brief ビット列をバイト列に変換する処理関数を作る。
-     * \return 作った処理関数。\n
-     */
-    bit_to_byte bits_to_bytes();
+    template <typename V, class K> typename UnsaturatedField<V, K>::residue
+        UnsaturatedField<V, K>::to_lane(const residue& val)
+    {
+        return pack(val);
+    }
 
-    void byte_to_bits(const int& byt, const put_bit& putBit);
+    template <typename V, class K> typename UnsaturatedField<V, K>::residue
+        UnsaturatedField<V, K>::from_lane(const residue& val)
+    {
+        return split(val);
+    }
 
-    /*!\brief バイト列をビット列に変換する処理関数を作る。
-     * \return 作った処理関数。\n
-     */
-    byte_to_bit bytes_to_bits();
+    template <typename V, class K>
+        typename UnsaturatedField<V, K>::wide_residue
+        UnsaturatedField<V, K>::widen(const residue& val)
+    {
+        return wide_residue(normalize(val));
+    }
 
-    int letter_to_digit(const int& let);
+    template <typename V, class K>
+        typename UnsaturatedField<V, K>::wide_residue
+        UnsaturatedField<V, K>::multiply_unreduced
+            (const residue& lhs, const residue& rhs)
+    {
+        return wide_residue(multiply(lhs, rhs));
+    }
 
-    /*!\brief 入力ストリームからバイト列の入力関数を作る。
-     *
-     * 入力関数はEOFに達すると`ecc::eof_exception`をスローする。\n
-     * \param is 入力ストリーム。\n
-     * \return 作った入力関数。\n
-     */
-    get_byte make_getter_from_istream(std::istream& is);
+    template <typename V, class K> typename UnsaturatedField<V, K>::residue
+        UnsaturatedField<V, K>::reduce_product(const wide_residue& val)
+    {
+        return reduce(residue(val));
+    }
 
-    /*!\brief 出力ストリームからバイト列の出力関数を作る。
-     *
-     * \param io 出力ストリーム。\n
-     * \return 作った出力関数。\n
-     */
-    put_byte make_putter_from_ostream(std::ostream& os);
+    template <typename V, class K> typename UnsaturatedField<V, K>::residue
+        UnsaturatedField<V, K>::subtract
+            (const residue& lhs, const residue& rhs)
+    {
+        if (!weak(rhs)) return subtract(lhs, normalize(rhs));
+        residue res(0);
+        for (size_t i = 0; i < K::NUMBER_OF_LIMBS; ++i)
+            res[i] = lhs[i] + bia_[i] - rhs[i];
+        return reduce(res);
+    }
 
-    //@}
+    template <typename V, class K> bool UnsaturatedField<V, K>::equal
+        (const residue& lhs, const residue& rhs)
+    {
+        constexpr uint64_t MASK = (uint64_t(1) << 52) - 1;
+        const residue dif = normalize(subtract(lhs, rhs));
+        uint64_t zer = 0, one = 0, two = 0, car = 0;
+        for (size_t i = 0; i < K::NUMBER_OF_LIMBS; ++i) {
+            const uint64_t dbl = 2 * ord_lim_[i] + car;
+            car = dbl >> 52;
+            zer |= dif[i];
+            one |= dif[i] ^ ord_lim_[i];
+            two |= dif[i] ^ (i + 1 < K::NUMBER_OF_LIMBS ? dbl & MASK : dbl);
+        }
+        return !zer || !one || !two;
+    }
 
-    //---- ecurve definition ----
+    template <typename V, class K> typename UnsaturatedField<V, K>::residue
+        UnsaturatedField<V, K>::canonicalize(const residue& val)
+    {
+        constexpr size_t N = K::NUMBER_OF_LIMBS;
+        residue res = normalize(val);
+        for (size_t t = 0; t < 2; ++t) {
+            uint64_t dif[N], bor = 0;
+            for (size_t i = 0; i < N; ++i) {
+                dif[i] = res[i] - ord_lim_[i] - bor;
+                bor = dif[i] >> 63;
+                dif[i] &= (uint64_t(1) << 52) - 1;
+            }
+            if (bor) break;
+            for (size_t i = 0; i < N; ++i) res[i] = dif[i];
+        }
+        return res;
+    }
 
-    template <typename V> PrimeField<V>::PrimeField
-        (const V& ord) : ord_(ord) {}
+    template <typename V, class K> typename UnsaturatedField<V, K>::residue
+        UnsaturatedField<V, K>::pack(const residue& val)
+    {
+        const residue lim = canonicalize(val);
+        residue res(0);
+        res[0] = lim[0] | lim[1] << 52;
+        res[1] = lim[1] >> 12 | lim[2] << 40;
+        res[2] = lim[2] >> 24 | lim[3] << 28;
+        res[3] = lim[3] >> 36 | lim[4] << 16;
+        return res;
+    }
 
-    template <typename V> V PrimeField<V>::order() {
-        return ord_;
+    template <typename V, class K> typename UnsaturatedField<V, K>::residue
+        UnsaturatedField<V, K>::normalize(const residue& val)
+    {
+        residue res = val;
+        K::normalize_limbs(&res[0]);
+        return res;
     }
 
-    template <typename V> element<V>::element
-        (PrimeField<V>*const priFie, const V& val) :
-            pri_fie_(priFie), val_(val)
+    template <typename V, class K> typename UnsaturatedField<V, K>::residue
+        UnsaturatedField<V, K>::split(const residue& val)
+    {
+        constexpr uint64_t MASK = (uint64_t(1) << 52) - 1;
+        residue res(0);
+        res[0] = val[0] & MASK;
+        res[1] = (val[0] >> 52 | val[1] << 12) & MASK;
+        res[2] = (val[1] >> 40 | val[2] << 24) & MASK;
+        res[3] = (val[2] >> 28 | val[3] << 36) & MASK;
+        res[4] = val[3] >> 16;
+        return res;
+    }
+
+    template <typename V, class K> bool UnsaturatedField<V, K>::weak
+        (const residue& val)
     {
-        val_ %= pri_fie_->order();
-        if (val_ < V(0)) val_ += pri_fie_->order();
+        return !((val[0] | val[1] | val[2] | val[3]) >> 52 | val[4] >> 49);
+    }
+
+    template <typename V, class K> V UnsaturatedField<V, K>::make_order() {
+        V ord(0);
+        for (size_t i = 0; i < K::NUMBER_OF_FIELDS; ++i) ord[i] = K::ORDER[i];
+        return ord;
     }
 
+    template <typename V> element<V>::element
+        (PrimeField<V>*const priFie, const V& val) :
+            pri_fie_(priFie), val_(priFie->encode(val)) {}
+
     template <typename V> element<V>::element
         (PrimeField<V>*const priFie, const element& ele) :
-            element(priFie, ele.val_) {}
+            element(priFie, ele.value()) {}
 
     template <typename V> bool element<V>::operator!=(const element& rhs)
         const
     {
-        return val_ != rhs.val_;
+        return !pri_fie_->equal(val_, rhs.val_);
     }
 
     template <typename V> element<V> element<V>::operator*
         (const element& rhs) const
     {
-        return element(pri_fie_, val_ * rhs.val_);
+        return from_internal(pri_fie_, pri_fie_->multiply(val_, rhs.val_));
     }
 
     template <typename V> rational_point<V> element<V>::operator*
@@ -2752,7 +5578,7 @@ namespace ecc {
     template <typename V> element<V> element<V>::operator+
         (const element& rhs) const
     {
-        return element(pri_fie_, val_ + rhs.val_);
+        return from_internal(pri_fie_, pri_fie_->add(val_, rhs.val_));
     }
 
     template <typename V> element<V>& element<V>::operator+=
@@ -2762,13 +5588,14 @@ namespace ecc {
     }
 
     template <typename V> element<V> element<V>::operator-() const {
-        return element(pri_fie_, -val_);
+        return from_internal
+            (pri_fie_, pri_fie_->subtract(residue(0), val_));
     }
 
     template <typename V> element<V> element<V>::operator-
         (const element& rhs) const
     {
-        return element(pri_fie_, val_ - rhs.val_);
+        return from_internal(pri_fie_, pri_fie_->subtract(val_, rhs.val_));
     }
 
     template <typename V> element<V>& element<V>::operator-=
@@ -2780,9 +5607,10 @@ namespace ecc {
     template <typename V> element<V> element<V>::operator/
         (const element& rhs) const
     {
-        V x, y;
-        gcdm(pri_fie_->order(), rhs.val_, &x, &y);
-        return element(pri_fie_, val_ * y);
+        return from_internal(
+            pri_fie_,
+            pri_fie_->multiply(val_, pri_fie_->invert(rhs.val_))
+        );
     }
 
     template <typename V> element<V>& element<V>::operator/=
@@ -2794,28 +5622,440 @@ namespace ecc {
     template <typename V> bool element<V>::operator==
         (const element& rhs) const
     {
-        return val_ == rhs.val_;
+        return pri_fie_->equal(val_, rhs.val_);
     }
 
     template <typename V> element<V>::operator bool() const {
-        return bool(val_);
+        return !pri_fie_->equal(val_, residue(0));
     }
 
     template <typename V> V element<V>::value() const {
-        return val_;
+        return pri_fie_->decode(val_);
+    }
+
+    template <typename V> element<V> square(const element<V>& ele) {
+        return element<V>::from_internal
+            (ele.pri_fie_, ele.pri_fie_->square(ele.val_));
+    }
+
+    template <typename V> element<V> halve(const element<V>& ele) {
+        return element<V>::from_internal
+            (ele.pri_fie_, ele.pri_fie_->halve(ele.val_));
+    }
+
+    template <typename V> element<V> multiply_small
+        (const element<V>& ele, const unsigned& mul)
+    {
+        if (!mul) return ele - ele;
+        unsigned bit = ~(~0u >> 1);
+        while (!(mul & bit)) bit >>= 1;
+        element<V> res = ele;
+        while (bit >>= 1) {
+            res = doubling(res);
+            if (mul & bit) res += ele;
+        }
+        return res;
+    }
+
+    template <typename V> bool is_square(const element<V>& ele) {
+        return ele.pri_fie_->is_square(ele.val_);
+    }
+
+    template <typename V> element<V> square_root(const element<V>& ele) {
+        return element<V>::from_internal
+            (ele.pri_fie_, ele.pri_fie_->square_root(ele.val_));
+    }
+
+    template <typename V> element<V> pow(const element<V>& ele, const V& exp) {
+        using residue = typename element<V>::residue;
+        PrimeField<V>*const priFie = ele.pri_fie_;
+        return element<V>::from_internal(priFie, exponentiate(
+            ele.val_,
+            exp,
+            priFie->encode(V(1)),
+            [priFie] (const residue& lhs, const residue& rhs) {
+                return priFie->multiply(lhs, rhs);
+            },
+            [priFie] (const residue& val) {
+                return priFie->square(val);
+            }
+        ));
+    }
+
+    template <typename V, size_t N> element<V> pow
+        (const element<V>& ele, const addition_chain_step (&cha)[N])
+    {
+        using residue = typename element<V>::residue;
+        PrimeField<V>*const priFie = ele.pri_fie_;
+        return element<V>::from_internal(priFie, exponentiate_with_chain(
+            ele.val_,
+            cha,
+            [priFie] (const residue& lhs, const residue& rhs) {
+                return priFie->multiply(lhs, rhs);
+            },
+            [priFie] (const residue& val) {
+                return priFie->square(val);
+            }
+        ));
+    }
+
+    template <typename I> void invert_batch(const I& beg, const I& end) {
+        using residue =
+            typename std::iterator_traits<I>::value_type::residue;
+        std::vector<residue> pros;
+        pros.reserve(std::distance(beg, end));
+        decltype(beg->pri_fie_) priFie = nullptr;
+        auto acc = residue(0);
+        size_t cnt = 0;
+        for (auto ite = beg; ite != end; ++ite) {
+            if (*ite) {
+                priFie = ite->pri_fie_;
+                acc = cnt++ ? priFie->multiply(acc, ite->val_) : ite->val_;
+            }
+            pros.push_back(acc);
+        }
+        if (!cnt) return;
+        residue inv = priFie->invert(acc);
+        auto ite = end;
+        for (size_t i = pros.size(); i--;) {
+            --ite;
+            if (!*ite) continue;
+            if (--cnt) {
+                const residue val = ite->val_;
+                ite->val_ = priFie->multiply(inv, pros[i - 1]);
+                inv = priFie->multiply(inv, val);
+            } else ite->val_ = inv;
+        }
+    }
+
+    template <typename V, size_t L> element_batch<V, L>::element_batch
+        (PrimeField<V>*const priFie) : pri_fie_(priFie) {}
+
+    template <typename V, size_t L> element<V>
+        element_batch<V, L>::get(const size_t& lan) const
+    {
+        return element<V>::from_internal
+            (pri_fie_, pri_fie_->from_lane(val_.get(lan)));
+    }
+
+    template <typename V, size_t L> void element_batch<V, L>::set
+        (const size_t& lan, const element<V>& ele)
+    {
+        val_.set(lan, pri_fie_->to_lane(ele.val_));
+    }
+
+    template <typename V, size_t L> element_batch<V, L>
+        element_batch<V, L>::operator*(const element_batch& rhs) const
+    {
+        element_batch res(pri_fie_);
+        if (!pri_fie_->multiply_lanes
+            (val_.digs_, rhs.val_.digs_, L, res.val_.digs_))
+        {
+            for (size_t i = 0; i < L; ++i) res.val_.set(
+                i,
+                pri_fie_->to_lane(pri_fie_->multiply(
+                    pri_fie_->from_lane(val_.get(i)),
+                    pri_fie_->from_lane(rhs.val_.get(i))
+                ))
+            );
+        }
+        return res;
+    }
+
+    template <typename V, size_t L> element_batch<V, L>
+        element_batch<V, L>::operator+(const element_batch& rhs) const
+    {
+        constexpr size_t D = digits::NUMBER_OF_DIGITS;
+        uint64_t ord[D];
+        order(ord);
+        element_batch res(pri_fie_);
+        kernels_for_batch().add_modulo
+            (val_.digs_, rhs.val_.digs_, ord, D, L, res.val_.digs_);
+        return res;
+    }
+
+    template <typename V, size_t L> element_batch<V, L>
+        element_batch<V, L>::operator-(const element_batch& rhs) const
+    {
+        constexpr size_t D = digits::NUMBER_OF_DIGITS;
+        uint64_t ord[D];
+        order(ord);
+        element_batch res(pri_fie_);
+        kernels_for_batch().subtract_modulo
+            (val_.digs_, rhs.val_.digs_, ord, D, L, res.val_.digs_);
+        return res;
+    }
+
+    template <typename V, size_t L> void element_batch<V, L>::order
+        (uint64_t*const ord) const
+    {
+        const residue& o = pri_fie_->ord_;
+        for (size_t i = 0; i < digits::NUMBER_OF_DIGITS; ++i)
+            ord[i] = (o[i / 2] >> (32 * (i % 2))) & 0xffffffff;
+    }
+
+    template <typename V> element_acc<V>::element_acc
+        (PrimeField<V>*const priFie) : pri_fie_(priFie), acc_(0), cnt_(0) {}
+
+    template <typename V> element_acc<V>& element_acc<V>::operator+=
+        (const element<V>& rhs)
+    {
+        accumulate(pri_fie_->widen(rhs.val_));
+        return *this;
+    }
+
+    template <typename V> element_acc<V>& element_acc<V>::operator-=
+        (const element<V>& rhs)
+    {
+        accumulate(pri_fie_->widen(pri_fie_->subtract(residue(0), rhs.val_)));
+        return *this;
+    }
+
+    template <typename V> element_acc<V>& element_acc<V>::multiply_add
+        (const element<V>& lhs, const element<V>& rhs)
+    {
+        accumulate(pri_fie_->multiply_unreduced(lhs.val_, rhs.val_));
+        return *this;
+    }
+
+    template <typename V> element_acc<V>& element_acc<V>::multiply_subtract
+        (const element<V>& lhs, const element<V>& rhs)
+    {
+        const residue neg = pri_fie_->subtract(residue(0), lhs.val_);
+        accumulate(pri_fie_->multiply_unreduced(neg, rhs.val_));
+        return *this;
+    }
+
+    template <typename V> element<V> element_acc<V>::value() const {
+        return element<V>::from_internal
+            (pri_fie_, pri_fie_->reduce_product(acc_));
+    }
+
+    template <typename V> void element_acc<V>::accumulate
+        (const wide_residue& ter)
+    {
+        if (cnt_ == pri_fie_->acc_cap_) {
+            acc_ = pri_fie_->widen(pri_fie_->reduce_product(acc_));
+            cnt_ = 1;
+        }
+        acc_ += ter;
+        ++cnt_;
+    }
+
+    template <typename V> element<V> element<V>::from_internal
+        (PrimeField<V>*const priFie, const residue& val)
+    {
+        element res;
+        res.pri_fie_ = priFie;
+        res.val_ = val;
+        return res;
     }
 
     template <typename V_> std::ostream& operator<<
         (std::ostream& os, const element<V_>& ele)
     {
-        return os << ele.val_;
+        return os << ele.value();
+    }
+
+    template <typename V, class K> constexpr size_t fp<V, K>::N;
+
+    template <typename V, class K> fp<V, K>::fp(const V& val) {
+        V num = val;
+        if (num < V(0)) num += make_order();
+        bool fit = !(num < V(0));
+        for (size_t i = 2 * N; fit && i < V::NUMBER_OF_FIELDS; ++i)
+            fit = !num[i];
+        if (!fit) {
+            const V ord = make_order();
+            num %= ord;
+            if (num < V(0)) num += ord;
+        }
+        uint64_t pro[2 * N] = {};
+        for (size_t i = 0; i < 2 * N && i < V::NUMBER_OF_FIELDS; ++i)
+            pro[i] = num[i];
+        K::reduce(pro);
+        for (size_t i = 0; i < N; ++i) fies_[i] = pro[i];
+    }
+
+    template <typename V, class K> bool fp<V, K>::operator!=
+        (const fp& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+    template <typename V, class K> fp<V, K> fp<V, K>::operator*
+        (const fp& rhs) const
+    {
+        uint64_t pro[2 * N];
+        multiply_fields_karatsuba<N>(fies_, rhs.fies_, pro);
+        K::reduce(pro);
+        fp res;
+        for (size_t i = 0; i < N; ++i) res.fies_[i] = pro[i];
+        return res;
+    }
+
+    template <typename V, class K> fp<V, K>& fp<V, K>::operator*=
+        (const fp& rhs)
+    {
+        return *this = *this * rhs;
+    }
+
+    template <typename V, class K> fp<V, K> fp<V, K>::operator+
+        (const fp& rhs) const
+    {
+        fp res;
+        uint64_t car = 0;
+        for (size_t i = 0; i < N; ++i)
+            res.fies_[i] = add_with_carry(fies_[i], rhs.fies_[i], &car);
+        res.reduce(car);
+        return res;
+    }
+
+    template <typename V, class K> fp<V, K>& fp<V, K>::operator+=
+        (const fp& rhs)
+    {
+        return *this = *this + rhs;
+    }
+
+    template <typename V, class K> fp<V, K> fp<V, K>::operator-() const {
+        fp zer;
+        for (size_t i = 0; i < N; ++i) zer.fies_[i] = 0;
+        return zer - *this;
+    }
+
+    template <typename V, class K> fp<V, K> fp<V, K>::operator-
+        (const fp& rhs) const
+    {
+        fp res;
+        uint64_t bor = 0;
+        for (size_t i = 0; i < N; ++i)
+            res.fies_[i] = subtract_with_borrow(fies_[i], rhs.fies_[i], &bor);
+        if (bor) {
+            uint64_t car = 0;
+            for (size_t i = 0; i < N; ++i)
+                res.fies_[i] = add_with_carry(res.fies_[i], K::ORDER[i], &car);
+        }
+        return res;
+    }
+
+    template <typename V, class K> fp<V, K>& fp<V, K>::operator-=
+        (const fp& rhs)
+    {
+        return *this = *this - rhs;
+    }
+
+    template <typename V, class K> fp<V, K> fp<V, K>::operator/
+        (const fp& rhs) const
+    {
+        using residue = typename narrow<V>::type;
+        residue val(0), ord(0);
+        for (size_t i = 0; i < N; ++i) {
+            val[i] = rhs.fies_[i];
+            ord[i] = K::ORDER[i];
+        }
+        const residue inv = invert_modulo(val, ord);
+        fp res;
+        for (size_t i = 0; i < N; ++i) res.fies_[i] = inv[i];
+        return *this * res;
+    }
+
+    template <typename V, class K> fp<V, K>& fp<V, K>::operator/=
+        (const fp& rhs)
+    {
+        return *this = *this / rhs;
+    }
+
+    template <typename V, class K> bool fp<V, K>::operator==
+        (const fp& rhs) const
+    {
+        uint64_t dif = 0;
+        for (size_t i = 0; i < N; ++i) dif |= fies_[i] ^ rhs.fies_[i];
+        return !dif;
+    }
+
+    template <typename V, class K> fp<V, K>::operator bool() const {
+        uint64_t acc = 0;
+        for (size_t i = 0; i < N; ++i) acc |= fies_[i];
+        return acc;
+    }
+
+    template <typename V, class K> V fp<V, K>::value() const {
+        V val(0);
+        for (size_t i = 0; i < N; ++i) val[i] = fies_[i];
+        return val;
+    }
+
+    template <typename V, class K> void fp<V, K>::reduce
+        (const uint64_t& car)
+    {
+        size_t i = N;
+        if (!car) {
+            while (i && fies_[i - 1] == K::ORDER[i - 1]) --i;
+            if (i && fies_[i - 1] < K::ORDER[i - 1]) return;
+        }
+        uint64_t bor = 0;
+        for (i = 0; i < N; ++i)
+            fies_[i] = subtract_with_borrow(fies_[i], K::ORDER[i], &bor);
+    }
+
+    template <typename V, class K> V fp<V, K>::make_order() {
+        V ord(0);
+        for (size_t i = 0; i < N; ++i) ord[i] = K::ORDER[i];
+        return ord;
+    }
+
+    template <typename V, class K> fp<V, K> square(const fp<V, K>& ele) {
+        constexpr size_t N = K::NUMBER_OF_FIELDS;
+        uint64_t pro[2 * N];
+        kernels().square(ele.fies_, N, pro);
+        K::reduce(pro);
+        fp<V, K> res;
+        for (size_t i = 0; i < N; ++i) res.fies_[i] = pro[i];
+        return res;
+    }
+
+    template <typename V, class K> fp<V, K> pow
+        (const fp<V, K>& ele, const V& exp)
+    {
+        return exponentiate(
+            ele,
+            exp,
+            fp<V, K>(V(1)),
+            [] (const fp<V, K>& lhs, const fp<V, K>& rhs) {
+                return lhs * rhs;
+            },
+            [] (const fp<V, K>& val) {
+                return square(val);
+            }
+        );
+    }
+
+    template <typename V, class K, size_t N> fp<V, K> pow
+        (const fp<V, K>& ele, const addition_chain_step (&cha)[N])
+    {
+        return exponentiate_with_chain(
+            ele,
+            cha,
+            [] (const fp<V, K>& lhs, const fp<V, K>& rhs) {
+                return lhs * rhs;
+            },
+            [] (const fp<V, K>& val) {
+                return square(val);
+            }
+        );
+    }
+
+    template <typename V_, class K_> std::ostream& operator<<
+        (std::ostream& os, const fp<V_, K_>& ele)
+    {
+        return os << ele.value();
     }
 
     template <typename V> EllipticCurve<V>::EllipticCurve(
         PrimeField<V>*const priFie,
         const element<V>& coeA,
         const element<V>& coeB
-    ) : coeA_(coeA), coeB_(coeB), priFie_(priFie) {}
+    ) : coeA_(coeA), coeB_(coeB), one_(priFie, V(1)), priFie_(priFie) {}
 
     template <typename V> element<V> EllipticCurve<V>::coefficientA() {
         return coeA_;
@@ -2829,6 +6069,10 @@ namespace ecc {
         return priFie_;
     }
 
+    template <typename V> element<V> EllipticCurve<V>::one() {
+        return one_;
+    }
+
     template <typename V> rational_point<V>::rational_point() :
         inf_(true) {}
 
@@ -2836,7 +6080,7 @@ namespace ecc {
         EllipticCurve<V>*const ec,
         const element<V>& x,
         const element<V>& y
-    ) : rational_point(ec, x, y, element<V>(ec->primeField(), V(1))) {}
+    ) : rational_point(ec, x, y, ec->one(), ec->coefficientA()) {}
 
     template <typename V> rational_point<V>::rational_point(
         EllipticCurve<V>*const ec,
@@ -2846,10 +6090,30 @@ namespace ecc {
     ) : rational_point
         (ec, x, y, z, ec->coefficientA() * square(square(z))) {}
 
+    template <typename V> bool rational_point<V>::decompress(
+        EllipticCurve<V>*const ec,
+        const element<V>& x,
+        const bool& odd,
+        rational_point*const poi
+    ) {
+        const element<V> rhs =
+            (square(x) + ec->coefficientA()) * x + ec->coefficientB();
+        element<V> y = square_root(rhs);
+        if (square(y) != rhs || (!y && odd)) return false;
+        if (bool(y.value() % V(2)) != odd) y = -y;
+        *poi = rational_point(ec, x, y);
+        return true;
+    }
+
     template <typename V> bool rational_point<V>::is_infinity() const {
         return inf_;
     }
 
+    template <typename V> bool rational_point<V>::is_odd() const {
+        const element<V> y = z_ == ec_->one() ? y_ : project().y_;
+        return bool(y.value() % V(2));
+    }
+
     template <typename V> bool rational_point<V>::operator!=
         (const rational_point& rhs) const
     {
@@ -2887,8 +6151,6 @@ namespace ecc {
         if (inf_) res = rhs;
         else if (rhs.inf_) res = *this;
         else {
-            const auto e =
-                factory<element<V>, PrimeField<V>>(ec_->primeField());
             if (*this != rhs) {
                 const element<V>
                     ZZ = square(z_),
@@ -2907,34 +6169,77 @@ namespace ecc {
                         u1hh = u1 * hh,
                         s1 = y_ * zzz,
                         s2 = rhs.y_ * ZZZ,
-                        r = s2 - s1,
-                        rr = square(r),
-                        x = -hhh - e(V(2)) * u1hh + rr,
-                        y = -s1 * hhh + r * (u1hh - x);
-                    res = rational_point(ec_, x, y, z);
+                        r = s2 - s1;
+                    element_acc<V> accOfX(ec_->primeField());
+                    accOfX.multiply_add(r, r);
+                    accOfX -= hhh;
+                    accOfX -= u1hh;
+                    accOfX -= u1hh;
+                    const element<V> x = accOfX.value();
+                    element_acc<V> accOfY(ec_->primeField());
+                    accOfY.multiply_subtract(s1, hhh);
+                    accOfY.multiply_add(r, u1hh - x);
+                    res = rational_point(ec_, x, accOfY.value(), z);
                 }
             } else {
-                const element<V> z(e(V(2)) * y_ * z_);
+                const element<V> z(doubling(y_ * z_));
                 if (z) {
                     const element<V>
                         XX = square(x_),
                         YY = square(y_),
                         YYYY = square(YY),
-                        YYYY8 = e(V(8)) * YYYY,
+                        YYYY8 = multiply_small(YYYY, 8),
                         YYYY16 = doubling(YYYY8),
-                        s = e(V(4)) * x_ * YY,
-                        m = e(V(3)) * XX + w_,
-                        mm = square(m),
-                        x = -e(V(2)) * s + mm,
-                        y = -YYYY8 + m * (s - x),
-                        w = YYYY16 * w_;
-                    res = rational_point(ec_, x, y, z, w);
+                        s = multiply_small(x_ * YY, 4),
+                        m = multiply_small(XX, 3) + w_;
+                    element_acc<V> accOfX(ec_->primeField());
+                    accOfX.multiply_add(m, m);
+                    accOfX -= s;
+                    accOfX -= s;
+                    const element<V> x = accOfX.value();
+                    element_acc<V> accOfY(ec_->primeField());
+                    accOfY -= YYYY8;
+                    accOfY.multiply_add(m, s - x);
+                    res = rational_point
+                        (ec_, x, accOfY.value(), z, YYYY16 * w_);
                 }
             }
         }
         return res;
     }
 
+    template <typename V> rational_point<V>
+        rational_point<V>::add_affine(const rational_point& rhs) const
+    {
+        rational_point res;
+        if (inf_) res = rhs;
+        else if (rhs.inf_) res = *this;
+        else {
+            const element<V>
+                ZZ = square(z_),
+                ZZZ = ZZ * z_,
+                h = rhs.x_ * ZZ - x_,
+                r = rhs.y_ * ZZZ - y_;
+            if (h) {
+                const element<V>
+                    hh = square(h),
+                    hhh = hh * h,
+                    u1hh = x_ * hh;
+                element_acc<V> accOfX(ec_->primeField());
+                accOfX.multiply_add(r, r);
+                accOfX -= hhh;
+                accOfX -= u1hh;
+                accOfX -= u1hh;
+                const element<V> x = accOfX.value();
+                element_acc<V> accOfY(ec_->primeField());
+                accOfY.multiply_subtract(y_, hhh);
+                accOfY.multiply_add(r, u1hh - x);
+                res = rational_point(ec_, x, accOfY.value(), z_ * h);
+            } else if (!r) res = *this + *this;
+        }
+        return res;
+    }
+
     template <typename V> rational_point<V>&
         rational_point<V>::operator+=(const rational_point& rhs)
     {
@@ -3012,6 +6317,75 @@ namespace ecc {
         return os << oss.str();
     }
 
+    template <typename V> FixedBaseTable<V>::FixedBaseTable(
+        const rational_point<V>& bas,
+        const size_t& numOfTee,
+        const size_t& numOfTab
+    ) : numOfTee_(numOfTee), numOfTab_(numOfTab) {
+        if (numOfTee_ < 1 || numOfTee_ > 16)
+            throw std::invalid_argument("numOfTee must be in [1, 16].");
+        if (numOfTab_ < 1)
+            throw std::invalid_argument("numOfTab must be at least 1.");
+        const size_t lenOfBit = 8 * (LOGICAL_SIZE_OF<V>() + 1);
+        lenOfRow_ = (lenOfBit + numOfTee_ - 1) / numOfTee_;
+        lenOfCol_ = (lenOfRow_ + numOfTab_ - 1) / numOfTab_;
+        const size_t numOfIdx = size_t(1) << numOfTee_;
+        std::vector<rational_point<V>> dbls(1, bas);
+        const size_t numOfDbl =
+            (numOfTee_ - 1) * lenOfRow_ + numOfTab_ * lenOfCol_;
+        for (size_t i = 1; i < numOfDbl; ++i)
+            dbls.push_back(dbls.back() + dbls.back());
+        pois_.resize(numOfTab_ * numOfIdx);
+        for (size_t i = 0; i < numOfTab_; ++i) {
+            for (size_t j = 1; j < numOfIdx; ++j) {
+                size_t top = 0;
+                while (j >> (top + 1)) ++top;
+                pois_[i * numOfIdx + j] =
+                    pois_[i * numOfIdx + (j ^ (size_t(1) << top))] +
+                    dbls[top * lenOfRow_ + i * lenOfCol_];
+            }
+        }
+        std::vector<element<V>> zs;
+        for (const auto& poi : pois_) {
+            if (!poi.is_infinity()) zs.push_back(poi.z());
+        }
+        invert_batch(zs.begin(), zs.end());
+        auto ite = zs.begin();
+        for (auto& poi : pois_) {
+            if (poi.is_infinity()) continue;
+            const element<V> zz = square(*ite), zzz = zz * *ite;
+            poi = rational_point<V>(bas.ec_, poi.x() * zz, poi.y() * zzz);
+            ++ite;
+        }
+    }
+
+    template <typename V> rational_point<V>
+        FixedBaseTable<V>::multiply(const element<V>& sca) const
+    {
+        std::vector<bool> bits;
+        number_to_bits<V, LOGICAL_SIZE_OF<V>() + 1>(
+            sca.value(),
+            make_putter_from_iterator<bool>(std::back_inserter(bits))
+        );
+        const size_t numOfIdx = size_t(1) << numOfTee_;
+        rational_point<V> res;
+        for (size_t i = lenOfCol_; i--;) {
+            res += res;
+            for (size_t j = numOfTab_; j--;) {
+                const size_t col = j * lenOfCol_ + i;
+                if (col >= lenOfRow_) continue;
+                size_t idx = 0;
+                for (size_t k = numOfTee_; k--;) {
+                    const size_t pos = k * lenOfRow_ + col;
+                    idx = idx << 1 |
+                        (pos < bits.size() && bits[bits.size() - 1 - pos]);
+                }
+                if (idx) res = res.add_affine(pois_[j * numOfIdx + idx]);
+            }
+        }
+        return res;
+    }
+
     //---- random definition ----
 
     template <typename V, class RBG>
@@ -3219,91 +6593,457 @@ namespace ecc {
 
     //---- binteger definition ----
 
-    template <size_t S, bool C> constexpr size_t
-        big_int<S, C>::LOGICAL_SIZE;
-    template <size_t S, bool C> constexpr size_t
-        big_int<S, C>::SIZE_OF_FIELD;
-    template <size_t S, bool C> constexpr size_t
-        big_int<S, C>::LENGTH_OF_BITS_ON_FIELD;
-    template <size_t S, bool C> constexpr uint64_t
-        big_int<S, C>::FIELD_MASK;
-    template <size_t S, bool C> constexpr size_t
-        big_int<S, C>::NUMBER_OF_FIELDS;
+    template <char... CS> constexpr big_int_literal<CS...>::big_int_literal
+        (const bool& neg) : neg_(neg) {}
+
+    template <char... CS> constexpr big_int_literal<CS...>
+        big_int_literal<CS...>::operator-() const
+    {
+        return big_int_literal(!neg_);
+    }
+
+    template <char... CS> constexpr bool
+        big_int_literal<CS...>::negative() const
+    {
+        return neg_;
+    }
+
+    template <char... CS> constexpr big_int_literal<CS...> operator"" _bi() {
+        return big_int_literal<CS...>();
+    }
+
+    inline uint64_t add_with_carry
+        (const uint64_t& lhs, const uint64_t& rhs, uint64_t*const car)
+    {
+#if defined(__SIZEOF_INT128__)
+        const unsigned __int128 sum =
+            (unsigned __int128)lhs + rhs + *car;
+        *car = uint64_t(sum >> 64);
+        return uint64_t(sum);
+#else
+        const uint64_t sum = lhs + rhs, res = sum + *car;
+        *car = (sum < lhs) | (res < sum);
+        return res;
+#endif
+    }
+
+    inline uint64_t subtract_with_borrow
+        (const uint64_t& lhs, const uint64_t& rhs, uint64_t*const bor)
+    {
+        const uint64_t dif = lhs - rhs, res = dif - *bor;
+        *bor = (lhs < rhs) | (dif < *bor);
+        return res;
+    }
+
+    inline uint64_t multiply_with_carry(
+        const uint64_t& lhs,
+        const uint64_t& rhs,
+        const uint64_t& add,
+        uint64_t*const car
+    ) {
+#if defined(__SIZEOF_INT128__)
+        const unsigned __int128 pro =
+            (unsigned __int128)lhs * rhs + add + *car;
+        *car = uint64_t(pro >> 64);
+        return uint64_t(pro);
+#else
+        const uint64_t
+            ll = (lhs & 0xffffffff) * (rhs & 0xffffffff),
+            lh = (lhs & 0xffffffff) * (rhs >> 32),
+            hl = (lhs >> 32) * (rhs & 0xffffffff),
+            hh = (lhs >> 32) * (rhs >> 32),
+            mid = (ll >> 32) + (lh & 0xffffffff) + (hl & 0xffffffff);
+        uint64_t
+            low = (mid << 32) | (ll & 0xffffffff),
+            hig = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+        low += add;
+        hig += low < add;
+        low += *car;
+        hig += low < *car;
+        *car = hig;
+        return low;
+#endif
+    }
+
+    inline uint64_t divide_with_remainder(
+        const uint64_t& hig,
+        const uint64_t& low,
+        const uint64_t& div,
+        uint64_t*const rem
+    ) {
+#if defined(__SIZEOF_INT128__)
+        const unsigned __int128 dividend =
+            ((unsigned __int128)hig << 64) | low;
+        const uint64_t quo = uint64_t(dividend / div);
+        if (rem) *rem = uint64_t(dividend % div);
+        return quo;
+#else
+        size_t len = 0;
+        while (!((div << len) >> 63)) ++len;
+        const uint64_t
+            ndiv = div << len,
+            dh = ndiv >> 32,
+            dl = ndiv & 0xffffffff,
+            nhig = len ? (hig << len) | (low >> (64 - len)) : hig,
+            nlow = low << len,
+            lh = nlow >> 32,
+            ll = nlow & 0xffffffff;
+        uint64_t qh = nhig / dh, r = nhig - qh * dh;
+        while (qh >> 32 || qh * dl > ((r << 32) | lh)) {
+            --qh;
+            r += dh;
+            if (r >> 32) break;
+        }
+        const uint64_t mid = (nhig << 32) + lh - qh * ndiv;
+        uint64_t ql = mid / dh;
+        r = mid - ql * dh;
+        while (ql >> 32 || ql * dl > ((r << 32) | ll)) {
+            --ql;
+            r += dh;
+            if (r >> 32) break;
+        }
+        if (rem) *rem = (((mid << 32) + ll) - ql * ndiv) >> len;
+        return (qh << 32) | ql;
+#endif
+    }
+
+    inline void multiply_add_fields(
+        uint64_t*const num,
+        const size_t& len,
+        const uint64_t& mul,
+        const uint64_t& add
+    ) {
+        uint64_t car = add;
+        for (size_t i = 0; i < len; ++i)
+            num[i] = multiply_with_carry(num[i], mul, 0, &car);
+    }
+
+    inline uint64_t divide_fields
+        (uint64_t*const num, const size_t& len, const uint64_t& div)
+    {
+        uint64_t rem = 0;
+        for (size_t i = len; i--;)
+            num[i] = divide_with_remainder(rem, num[i], div, &rem);
+        return rem;
+    }
+
+    inline void multiply_fields(
+        const uint64_t*const lhs,
+        const uint64_t*const rhs,
+        const size_t& len,
+        uint64_t*const pro
+    ) {
+        std::memset(pro, 0, sizeof(uint64_t) * 2 * len);
+        for (size_t i = 0; i < len; ++i) {
+            uint64_t car = 0;
+            for (size_t j = 0; j < len; ++j) pro[i + j] =
+                multiply_with_carry(lhs[i], rhs[j], pro[i + j], &car);
+            pro[i + len] = car;
+        }
+    }
+
+    inline void square_fields
+        (const uint64_t*const num, const size_t& len, uint64_t*const pro)
+    {
+        if (!len) return;
+        for (size_t i = 0; i < len; ++i) pro[i] = 0;
+        for (size_t i = 0; i < len; ++i) {
+            uint64_t car = 0;
+            for (size_t j = i + 1; j < len; ++j) pro[i + j] =
+                multiply_with_carry(num[i], num[j], pro[i + j], &car);
+            pro[i + len] = car;
+        }
+        pro[2 * len - 1] = 0;
+        uint64_t hig = 0, car = 0;
+        for (size_t i = 0; i < len; ++i) {
+            const uint64_t
+                low = pro[2 * i],
+                mid = pro[2 * i + 1];
+            uint64_t sqhi = 0;
+            const uint64_t sqlo = multiply_with_carry(num[i], num[i], 0, &sqhi);
+            pro[2 * i] = add_with_carry((low << 1) | hig, sqlo, &car);
+            pro[2 * i + 1] =
+                add_with_carry((mid << 1) | (low >> 63), sqhi, &car);
+            hig = mid >> 63;
+        }
+    }
+
+    inline void multiply_accumulate
+        (const uint64_t& lhs, const uint64_t& rhs, uint64_t*const acc)
+    {
+        uint64_t hig = 0, car = 0;
+        const uint64_t low = multiply_with_carry(lhs, rhs, 0, &hig);
+        acc[0] = add_with_carry(acc[0], low, &car);
+        acc[1] = add_with_carry(acc[1], hig, &car);
+        acc[2] += car;
+    }
+
+    template <size_t N, size_t K, size_t... IS> inline void multiply_column(
+        const uint64_t*const lhs,
+        const uint64_t*const rhs,
+        uint64_t*const acc,
+        std::index_sequence<IS...>
+    ) {
+        constexpr size_t B = K < N ? 0 : K - N + 1;
+        const int seq[] = {
+            0,
+            (multiply_accumulate(lhs[B + IS], rhs[K - B - IS], acc), 0)...
+        };
+        (void)seq;
+        (void)acc;
+    }
+
+    template <size_t N, size_t... KS> inline void multiply_columns(
+        const uint64_t*const lhs,
+        const uint64_t*const rhs,
+        uint64_t*const pro,
+        std::index_sequence<KS...>
+    ) {
+        uint64_t acc[3] = {0, 0, 0};
+        const int seq[] = {
+            0,
+            (
+                multiply_column<N, KS>(
+                    lhs,
+                    rhs,
+                    acc,
+                    std::make_index_sequence
+                        <(KS < N ? KS + 1 : 2 * N - 1 - KS)>()
+                ),
+                pro[KS] = acc[0],
+                acc[0] = acc[1],
+                acc[1] = acc[2],
+                acc[2] = 0,
+                0
+            )...
+        };
+        (void)seq;
+    }
+
+    template <size_t N, size_t L> inline void multiply_fields(
+        const uint64_t*const lhs,
+        const uint64_t*const rhs,
+        uint64_t*const pro
+    ) {
+        static_assert(L <= 2 * N, "L must not exceed 2 * N.");
+        multiply_columns<N>(lhs, rhs, pro, std::make_index_sequence<L>());
+    }
 
-    template <size_t S, bool C> big_int<S, C>::big_int
-        (const big_int& ano)
+    template <size_t N, size_t L, size_t T> inline void
+        multiply_fields_karatsuba(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            uint64_t*const pro,
+            std::false_type
+        )
     {
-        std::memcpy
-            (fies_, ano.fies_, sizeof(uint64_t) * NUMBER_OF_FIELDS);
+        multiply_fields<N, L>(lhs, rhs, pro);
     }
 
-    template <size_t S, bool C> big_int<S, C>::big_int
+    template <size_t N, size_t L, size_t T> inline void
+        multiply_fields_karatsuba(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            uint64_t*const pro,
+            std::true_type
+        )
+    {
+        constexpr size_t M = N / 2, H = N - M;
+        uint64_t ful[2 * N], slhs[H], srhs[H], mid[2 * H + 1];
+        multiply_fields_karatsuba<M, 2 * M, T>(lhs, rhs, ful);
+        multiply_fields_karatsuba<H, 2 * H, T>(lhs + M, rhs + M, ful + 2 * M);
+        uint64_t lcar = 0, rcar = 0;
+        for (size_t i = 0; i < H; ++i) {
+            slhs[i] = add_with_carry(lhs[M + i], i < M ? lhs[i] : 0, &lcar);
+            srhs[i] = add_with_carry(rhs[M + i], i < M ? rhs[i] : 0, &rcar);
+        }
+        multiply_fields_karatsuba<H, 2 * H, T>(slhs, srhs, mid);
+        const uint64_t lmas = 0 - lcar, rmas = 0 - rcar;
+        uint64_t car = 0, bor = 0;
+        for (size_t i = 0; i < H; ++i)
+            mid[H + i] = add_with_carry(mid[H + i], srhs[i] & lmas, &car);
+        mid[2 * H] = car;
+        car = 0;
+        for (size_t i = 0; i < H; ++i)
+            mid[H + i] = add_with_carry(mid[H + i], slhs[i] & rmas, &car);
+        mid[2 * H] += car + (lcar & rcar);
+        for (size_t i = 0; i <= 2 * H; ++i) mid[i] =
+            subtract_with_borrow(mid[i], i < 2 * M ? ful[i] : 0, &bor);
+        bor = 0;
+        for (size_t i = 0; i <= 2 * H; ++i) mid[i] =
+            subtract_with_borrow(mid[i], i < 2 * H ? ful[2 * M + i] : 0, &bor);
+        car = 0;
+        for (size_t i = M; i < 2 * N; ++i) ful[i] =
+            add_with_carry(ful[i], i - M <= 2 * H ? mid[i - M] : 0, &car);
+        for (size_t i = 0; i < L; ++i) pro[i] = ful[i];
+    }
+
+    template <size_t N, size_t L, size_t T> inline void
+        multiply_fields_karatsuba(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            uint64_t*const pro
+        )
+    {
+        static_assert(L <= 2 * N, "L must not exceed 2 * N.");
+        static_assert(T >= 2, "T must be at least 2.");
+        multiply_fields_karatsuba<N, L, T>
+            (lhs, rhs, pro, std::integral_constant<bool, N >= T>());
+    }
+
+    template <size_t S, bool C, bool W, bool U> constexpr size_t
+        big_int<S, C, W, U>::LOGICAL_SIZE;
+    template <size_t S, bool C, bool W, bool U> constexpr size_t
+        big_int<S, C, W, U>::SIZE_OF_FIELD;
+    template <size_t S, bool C, bool W, bool U> constexpr size_t
+        big_int<S, C, W, U>::LENGTH_OF_BITS_ON_FIELD;
+    template <size_t S, bool C, bool W, bool U> constexpr uint64_t
+        big_int<S, C, W, U>::FIELD_MASK;
+    template <size_t S, bool C, bool W, bool U> constexpr size_t
+        big_int<S, C, W, U>::NUMBER_OF_FIELDS;
+
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>::big_int
         (const int& num) : big_int(int64_t(num)) {}
 
-    template <size_t S, bool C> big_int<S, C>::big_int
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>::big_int
         (const unsigned& num) : big_int(uint64_t(num)) {}
 
-    template <size_t S, bool C> big_int<S, C>::big_int
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>::big_int
         (const int64_t&num)
     {
-        auto n = big_int(uint64_t(num));
-        if (num < 0) {
-            for (size_t i = 2; i < NUMBER_OF_FIELDS; ++i)
-                n.fies_[i] = FIELD_MASK;
-        }
-        *this = n;
+        fies_[0] = uint64_t(num);
+        const uint64_t ext = num < 0 ? FIELD_MASK : 0;
+        for (size_t i = 1; i < NUMBER_OF_FIELDS; ++i) fies_[i] = ext;
     }
 
-    template <size_t S, bool C> big_int<S, C>::big_int
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>::big_int
         (const uint64_t&num)
     {
-        fies_[0] = num & FIELD_MASK;
-        fies_[1] = num >> LENGTH_OF_BITS_ON_FIELD;
+        fies_[0] = num;
         std::memset
-            (fies_ + 2, 0, sizeof(uint64_t) * (NUMBER_OF_FIELDS - 2));
+            (fies_ + 1, 0, sizeof(uint64_t) * (NUMBER_OF_FIELDS - 1));
+    }
+
+    template <size_t S, bool C, bool W, bool U> template <bool W_, bool U_>
+        big_int<S, C, W, U>::big_int(const big_int<S, C, W_, U_>& ano)
+    {
+        constexpr size_t N = big_int<S, C, W_, U_>::NUMBER_OF_FIELDS;
+        const uint64_t ext =
+            !U_ && ano[N - 1] >> (LENGTH_OF_BITS_ON_FIELD - 1) ?
+                FIELD_MASK : 0;
+        for (size_t i = 0; i < NUMBER_OF_FIELDS; ++i)
+            fies_[i] = i < N ? ano[i] : ext;
+    }
+
+    template <size_t S, bool C, bool W, bool U> template <char... CS> constexpr
+        big_int<S, C, W, U>::big_int(const big_int_literal<CS...>& lit) :
+            fies_()
+    {
+        constexpr char STR[] = {CS..., '\0'};
+        size_t i = 0;
+        uint64_t rad = 10;
+        if (STR[0] == '0' && (STR[1] == 'x' || STR[1] == 'X')) {
+            rad = 16;
+            i = 2;
+        } else if (STR[0] == '0' && (STR[1] == 'b' || STR[1] == 'B')) {
+            rad = 2;
+            i = 2;
+        } else if (STR[0] == '0') rad = 8;
+        for (; STR[i]; ++i) {
+            const char let = STR[i];
+            if (let == '\'') continue;
+            uint64_t car = uint64_t(
+                let <= '9' ? let - '0' :
+                let <= 'Z' ? let - 'A' + 10 : let - 'a' + 10
+            );
+            for (size_t j = 0; j < NUMBER_OF_FIELDS; ++j) {
+                const uint64_t
+                    low = (fies_[j] & 0xffffffff) * rad + car,
+                    hig = (fies_[j] >> 32) * rad + (low >> 32);
+                fies_[j] = (hig << 32) | (low & 0xffffffff);
+                car = hig >> 32;
+            }
+        }
+        if (lit.negative()) {
+            uint64_t car = 1;
+            for (size_t j = 0; j < NUMBER_OF_FIELDS; ++j) {
+                fies_[j] = ~fies_[j] + car;
+                car = car && !fies_[j];
+            }
+        }
     }
 
-    template <size_t S, bool C> big_int<S, C>::big_int
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>::big_int
         (const char*const str, const std::ios::fmtflags& bas) :
             big_int(str, str + std::strlen(str), bas) {}
 
-    template <size_t S, bool C> big_int<S, C>::big_int
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>::big_int
         (const std::string& str, const std::ios::fmtflags& bas) :
             big_int(str.begin(), str.end(), bas) {}
 
-    template <size_t S, bool C> template <typename I>
-        big_int<S, C>::big_int
+    template <size_t S, bool C, bool W, bool U> template <typename I>
+        big_int<S, C, W, U>::big_int
             (const I& beg, const I& end, const std::ios::fmtflags& bas)
     {
         if (beg != end) {
             I ite = beg;
             const int lea = *ite;
             if (lea == '+' || lea == '-') ++ite;
-            const auto rad = big_int(base_to_radix(bas));
+            const uint64_t
+                rad = base_to_radix(bas),
+                maxOfMul = ~uint64_t(0) / rad,
+                maxOfChu = (~uint64_t(0) - 15) / rad;
             auto num = big_int(0);
-            for (; ite != end; ++ite)
-                num = num * rad + big_int(letter_to_digit(*ite));
+            uint64_t chu = 0, mul = 1;
+            for (; ite != end; ++ite) {
+                if (mul > maxOfMul || chu > maxOfChu) {
+                    multiply_add_fields(num.fies_, NUMBER_OF_FIELDS, mul, chu);
+                    chu = 0;
+                    mul = 1;
+                }
+                chu = chu * rad + letter_to_digit(*ite);
+                mul *= rad;
+            }
+            multiply_add_fields(num.fies_, NUMBER_OF_FIELDS, mul, chu);
             if ((bas & std::ios::dec) && lea == '-') num = -num;
             *this = num;
         }
     }
 
-    template <size_t S, bool C> big_int<S, C>
-        big_int<S, C>::operator&(const big_int& rhs) const
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        big_int<S, C, W, U>::from_bytes
+            (const uint8_t*const byts, const size_t& siz, const bool& ord)
+    {
+        big_int num;
+        bytes_to_fields(num.fies_, NUMBER_OF_FIELDS, byts, siz, ord);
+        return num;
+    }
+
+    template <size_t S, bool C, bool W, bool U>
+        void big_int<S, C, W, U>::to_bytes
+            (uint8_t*const byts, const size_t& siz, const bool& ord) const
+    {
+        fields_to_bytes(fies_, NUMBER_OF_FIELDS, byts, siz, ord);
+    }
+
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        big_int<S, C, W, U>::operator&(const big_int& rhs) const
     {
-        big_int<S, C> res;
+        big_int<S, C, W, U> res;
         for (size_t i = 0; i < NUMBER_OF_FIELDS; ++i)
             res.fies_[i] = fies_[i] & rhs.fies_[i];
         return res;
     }
 
-    template <size_t S, bool C> big_int<S, C>&
-        big_int<S, C>::operator&=(const big_int& rhs)
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>&
+        big_int<S, C, W, U>::operator&=(const big_int& rhs)
     {
         return *this = *this & rhs;
     }
 
-    template <size_t S, bool C> big_int<S, C>::operator bool() const {
+    template <size_t S, bool C, bool W, bool U>
+        big_int<S, C, W, U>::operator bool() const
+    {
         bool res = false;
         for (size_t i = 0; i < NUMBER_OF_FIELDS; ++i) {
             if (fies_[i]) {
@@ -3314,163 +7054,137 @@ namespace ecc {
         return res;
     }
 
-    template <size_t S, bool C> big_int<S, C>::operator int() const {
+    template <size_t S, bool C, bool W, bool U>
+        big_int<S, C, W, U>::operator int() const
+    {
         return int(uint64_t(*this));
     }
 
-    template <size_t S, bool C> big_int<S, C>::operator int64_t() const {
+    template <size_t S, bool C, bool W, bool U>
+        big_int<S, C, W, U>::operator int64_t() const
+    {
         return int64_t(uint64_t(*this));
     }
 
-    template <size_t S, bool C> big_int<S, C>::operator uint64_t() const {
-        return fies_[0] | (fies_[1] << LENGTH_OF_BITS_ON_FIELD);
+    template <size_t S, bool C, bool W, bool U>
+        big_int<S, C, W, U>::operator uint64_t() const
+    {
+        return fies_[0];
     }
 
-    template <size_t S, bool C> big_int<S, C>::operator unsigned() const {
+    template <size_t S, bool C, bool W, bool U>
+        big_int<S, C, W, U>::operator unsigned() const
+    {
         return unsigned(uint64_t(*this));
     }
 
-    template <size_t S, bool C> bool
-        big_int<S, C>::operator!=(const big_int& rhs) const
+    template <size_t S, bool C, bool W, bool U> bool
+        big_int<S, C, W, U>::operator!=(const big_int& rhs) const
     {
         return compare(rhs) != 0;
     }
 
-    template <size_t S, bool C> big_int<S, C>
-        big_int<S, C>::operator%(const big_int& rhs) const
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        big_int<S, C, W, U>::operator%(const big_int& rhs) const
     {
         return divide(rhs, nullptr);
     }
 
-    template <size_t S, bool C> big_int<S, C>&
-        big_int<S, C>::operator%=(const big_int& rhs)
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>&
+        big_int<S, C, W, U>::operator%=(const big_int& rhs)
     {
         return *this = *this % rhs;
     }
 
-    template <size_t S, bool C> big_int<S, C>
-        big_int<S, C>::operator*(const big_int& rhs) const
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        big_int<S, C, W, U>::operator*(const big_int& rhs) const
     {
-        const bool lmsb = msb(), rmsb = rhs.msb();
-        big_int alhs, arhs;
-        if (lmsb) alhs = -*this;
-        else alhs = *this;
-        if (rmsb) arhs = -rhs;
-        else arhs = rhs;
-        big_int pro(0);
-        for (size_t i = 0; i < NUMBER_OF_FIELDS; ++i) {
-            if (alhs.fies_[i]) {
-                for (size_t j = 0; j < NUMBER_OF_FIELDS - i; ++j) {
-                    if (arhs.fies_[j]) {
-                        const size_t k = i + j;
-                        const uint64_t
-                            par = alhs.fies_[i] * arhs.fies_[j],
-                            low = par & FIELD_MASK,
-                            hig = par >> LENGTH_OF_BITS_ON_FIELD;
-                        pro.fies_[k] += low;
-                        if (k < NUMBER_OF_FIELDS - 1)
-                            pro.fies_[k + 1] += hig;
-                    }
-                }
-            }
-        }
-        for (size_t i = 0; i < NUMBER_OF_FIELDS - 1; ++i) {
-            const uint64_t
-                low = pro.fies_[i] & FIELD_MASK,
-                hig = pro.fies_[i] >> LENGTH_OF_BITS_ON_FIELD;
-            pro.fies_[i] = low;
-            if (i < NUMBER_OF_FIELDS - 1) pro.fies_[i + 1] += hig;
-        }
-        if (lmsb != rmsb) pro = -pro;
+        big_int pro;
+        multiply_fields_karatsuba<NUMBER_OF_FIELDS, NUMBER_OF_FIELDS>
+            (fies_, rhs.fies_, pro.fies_);
         return pro;
     }
 
-    template <size_t S, bool C> big_int<S, C>&
-        big_int<S, C>::operator*=(const big_int& rhs)
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>&
+        big_int<S, C, W, U>::operator*=(const big_int& rhs)
     {
         return *this = *this * rhs;
     }
 
-    template <size_t S, bool C> big_int<S, C>
-        big_int<S, C>::operator+(const big_int& rhs) const
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        big_int<S, C, W, U>::operator+(const big_int& rhs) const
     {
         big_int sum;
         uint64_t car = 0;
-        for (size_t i = 0; i < NUMBER_OF_FIELDS; ++i) {
-            sum.fies_[i] = fies_[i] + rhs.fies_[i] + car;
-            car = sum.fies_[i] >> LENGTH_OF_BITS_ON_FIELD;
-            sum.fies_[i] &= FIELD_MASK;
-        }
+        for (size_t i = 0; i < NUMBER_OF_FIELDS; ++i)
+            sum.fies_[i] = add_with_carry(fies_[i], rhs.fies_[i], &car);
         return sum;
     }
 
-    template <size_t S, bool C> big_int<S, C>&
-        big_int<S, C>::operator++()
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>&
+        big_int<S, C, W, U>::operator++()
     {
         return *this += big_int(1);
     }
 
-    template <size_t S, bool C> big_int<S, C>
-        big_int<S, C>::operator++(int)
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        big_int<S, C, W, U>::operator++(int)
     {
         const big_int las(*this);
         *this += big_int(1);
         return las;
     }
 
-    template <size_t S, bool C> big_int<S, C>&
-        big_int<S, C>::operator+=(const big_int& rhs)
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>&
+        big_int<S, C, W, U>::operator+=(const big_int& rhs)
     {
         return *this = *this + rhs;
     }
 
-    template <size_t S, bool C> big_int<S, C>
-        big_int<S, C>::operator-() const
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        big_int<S, C, W, U>::operator-() const
     {
         return ~*this + big_int(1);
     }
 
-    template <size_t S, bool C> big_int<S, C>
-        big_int<S, C>::operator-(const big_int& rhs) const
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        big_int<S, C, W, U>::operator-(const big_int& rhs) const
     {
         big_int dif;
         uint64_t bor = 0;
-        for (size_t i = 0; i < NUMBER_OF_FIELDS; ++i) {
-            dif.fies_[i] = fies_[i] - rhs.fies_[i] - bor;
-            bor = (dif.fies_[i] >> LENGTH_OF_BITS_ON_FIELD) & 1;
-            dif.fies_[i] &= FIELD_MASK;
-        }
+        for (size_t i = 0; i < NUMBER_OF_FIELDS; ++i)
+            dif.fies_[i] = subtract_with_borrow(fies_[i], rhs.fies_[i], &bor);
         return dif;
     }
 
-    template <size_t S, bool C> big_int<S, C>&
-        big_int<S, C>::operator-=(const big_int& rhs)
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>&
+        big_int<S, C, W, U>::operator-=(const big_int& rhs)
     {
         return *this = *this - rhs;
     }
 
-    template <size_t S, bool C> big_int<S, C>
-        big_int<S, C>::operator/(const big_int& rhs) const
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        big_int<S, C, W, U>::operator/(const big_int& rhs) const
     {
         big_int quo;
         divide(rhs, &quo);
         return quo;
     }
 
-    template <size_t S, bool C> big_int<S, C>&
-        big_int<S, C>::operator/=(const big_int& rhs)
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>&
+        big_int<S, C, W, U>::operator/=(const big_int& rhs)
     {
         return *this = *this / rhs;
     }
 
-    template <size_t S, bool C> bool
-        big_int<S, C>::operator<(const big_int& rhs) const
+    template <size_t S, bool C, bool W, bool U> bool
+        big_int<S, C, W, U>::operator<(const big_int& rhs) const
     {
         return compare(rhs) < 0;
     }
 
-    template <size_t S, bool C> big_int<S, C>
-        big_int<S, C>::operator<<(const int& len) const
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        big_int<S, C, W, U>::operator<<(const int& len) const
     {
         big_int res;
         if (!len) res = *this;
@@ -3479,8 +7193,8 @@ namespace ecc {
         return res;
     }
 
-    template <size_t S, bool C> big_int<S, C>
-        big_int<S, C>::operator<<(const size_t& len) const
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        big_int<S, C, W, U>::operator<<(const size_t& len) const
     {
         big_int res;
         const size_t
@@ -3494,7 +7208,7 @@ namespace ecc {
                 if (k > 0)
                     low = fies_[k - 1] >> (LENGTH_OF_BITS_ON_FIELD - rem);
                 else low = 0;
-                const uint64_t hig = (fies_[k] << rem) & FIELD_MASK;
+                const uint64_t hig = fies_[k] << rem;
                 res.fies_[j] = low | hig;
             }
         } else
@@ -3507,52 +7221,44 @@ namespace ecc {
         return res;
     }
 
-    template <size_t S, bool C> big_int<S, C>&
-        big_int<S, C>::operator<<=(const int& len)
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>&
+        big_int<S, C, W, U>::operator<<=(const int& len)
     {
         return *this = *this << len;
     }
 
-    template <size_t S, bool C> big_int<S, C>&
-        big_int<S, C>::operator<<=(const size_t& len)
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>&
+        big_int<S, C, W, U>::operator<<=(const size_t& len)
     {
         return *this = *this << len;
     }
 
-    template <size_t S, bool C> bool
-        big_int<S, C>::operator<=(const big_int& rhs) const
+    template <size_t S, bool C, bool W, bool U> bool
+        big_int<S, C, W, U>::operator<=(const big_int& rhs) const
     {
         return compare(rhs) <= 0;
     }
 
-    template <size_t S, bool C> big_int<S, C>&
-        big_int<S, C>::operator=(const big_int& rhs)
-    {
-        if (this != &rhs) std::memcpy
-            (fies_, rhs.fies_, sizeof(uint64_t) * NUMBER_OF_FIELDS);
-        return *this;
-    }
-
-    template <size_t S, bool C> bool
-        big_int<S, C>::operator==(const big_int& rhs) const
+    template <size_t S, bool C, bool W, bool U> bool
+        big_int<S, C, W, U>::operator==(const big_int& rhs) const
     {
         return compare(rhs) == 0;
     }
 
-    template <size_t S, bool C> bool
-        big_int<S, C>::operator>(const big_int& rhs) const
+    template <size_t S, bool C, bool W, bool U> bool
+        big_int<S, C, W, U>::operator>(const big_int& rhs) const
     {
         return compare(rhs) > 0;
     }
 
-    template <size_t S, bool C> bool
-        big_int<S, C>::operator>=(const big_int& rhs) const
+    template <size_t S, bool C, bool W, bool U> bool
+        big_int<S, C, W, U>::operator>=(const big_int& rhs) const
     {
         return compare(rhs) >= 0;
     }
 
-    template <size_t S, bool C> big_int<S, C>
-        big_int<S, C>::operator>>(const int& len) const
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        big_int<S, C, W, U>::operator>>(const int& len) const
     {
         big_int res;
         if (!len) res = *this;
@@ -3561,8 +7267,8 @@ namespace ecc {
         return res;
     }
 
-    template <size_t S, bool C> big_int<S, C>
-        big_int<S, C>::operator>>(const size_t& len) const
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        big_int<S, C, W, U>::operator>>(const size_t& len) const
     {
         big_int res;
         const bool msb_ = msb();
@@ -3576,13 +7282,9 @@ namespace ecc {
                 const uint64_t low = fies_[j] >> rem;
                 uint64_t hig;
                 if (j < NUMBER_OF_FIELDS - 1)
-                    hig = (fies_[j + 1] <<
-                        (LENGTH_OF_BITS_ON_FIELD - rem)
-                    ) & FIELD_MASK;
+                    hig = fies_[j + 1] << (LENGTH_OF_BITS_ON_FIELD - rem);
                 else if (msb_)
-                    hig = (FIELD_MASK <<
-                        (LENGTH_OF_BITS_ON_FIELD - rem)
-                    ) & FIELD_MASK;
+                    hig = FIELD_MASK << (LENGTH_OF_BITS_ON_FIELD - rem);
                 else hig = 0;
                 res.fies_[i] = low | hig;
             }
@@ -3606,85 +7308,86 @@ namespace ecc {
         return res;
     }
 
-    template <size_t S, bool C> big_int<S, C>&
-        big_int<S, C>::operator>>=(const int& len)
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>&
+        big_int<S, C, W, U>::operator>>=(const int& len)
     {
         return *this = *this >> len;
     }
 
-    template <size_t S, bool C> big_int<S, C>&
-        big_int<S, C>::operator>>=(const size_t& len)
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>&
+        big_int<S, C, W, U>::operator>>=(const size_t& len)
     {
         return *this = *this >> len;
     }
 
-    template <size_t S, bool C> const uint64_t&
-        big_int<S, C>::operator[](const size_t& index) const
+    template <size_t S, bool C, bool W, bool U> const uint64_t&
+        big_int<S, C, W, U>::operator[](const size_t& index) const
     {
         return fies_[index];
     }
 
-    template <size_t S, bool C> uint64_t&
-        big_int<S, C>::operator[](const size_t& index)
+    template <size_t S, bool C, bool W, bool U> uint64_t&
+        big_int<S, C, W, U>::operator[](const size_t& index)
     {
         return fies_[index];
     }
 
-    template <size_t S, bool C> big_int<S, C>
-        big_int<S, C>::operator^(const big_int& rhs) const
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        big_int<S, C, W, U>::operator^(const big_int& rhs) const
     {
-        big_int<S, C> res;
+        big_int<S, C, W, U> res;
         for (size_t i = 0; i < NUMBER_OF_FIELDS; ++i)
             res.fies_[i] = fies_[i] ^ rhs.fies_[i];
         return res;
     }
 
-    template <size_t S, bool C> big_int<S, C>&
-        big_int<S, C>::operator^=(const big_int& rhs)
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>&
+        big_int<S, C, W, U>::operator^=(const big_int& rhs)
     {
         return *this = *this ^ rhs;
     }
 
-    template <size_t S, bool C> big_int<S, C>
-        big_int<S, C>::operator|(const big_int& rhs) const
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        big_int<S, C, W, U>::operator|(const big_int& rhs) const
     {
-        big_int<S, C> res;
+        big_int<S, C, W, U> res;
         for (size_t i = 0; i < NUMBER_OF_FIELDS; ++i)
             res.fies_[i] = fies_[i] | rhs.fies_[i];
         return res;
     }
 
-    template <size_t S, bool C> big_int<S, C>&
-        big_int<S, C>::operator|=(const big_int& rhs)
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>&
+        big_int<S, C, W, U>::operator|=(const big_int& rhs)
     {
         return *this = *this | rhs;
     }
 
-    template <size_t S, bool C> big_int<S, C>
-        big_int<S, C>::operator~() const
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        big_int<S, C, W, U>::operator~() const
     {
-        big_int<S, C> res;
+        big_int<S, C, W, U> res;
         for (size_t i = 0; i < NUMBER_OF_FIELDS; ++i)
-            res.fies_[i] = fies_[i] ^ FIELD_MASK;
+            res.fies_[i] = ~fies_[i];
         return res;
     }
 
-    template <size_t S, bool C> int64_t
-        big_int<S, C>::compare(const big_int& rhs) const
+    template <size_t S, bool C, bool W, bool U> int64_t
+        big_int<S, C, W, U>::compare(const big_int& rhs) const
     {
-        int64_t res = rhs.msb() - msb();
+        int64_t res = int64_t(rhs.msb()) - int64_t(msb());
         if (!res) {
             for (size_t i = 0; i < NUMBER_OF_FIELDS; ++i) {
                 const size_t j = NUMBER_OF_FIELDS - i - 1;
-                res = int64_t(fies_[j]) - int64_t(rhs.fies_[j]);
+                res = int64_t(fies_[j] > rhs.fies_[j]) -
+                    int64_t(fies_[j] < rhs.fies_[j]);
                 if (res) break;
             }
         }
         return res;
     }
 
-    template <size_t S, bool C> big_int<S, C>big_int<S, C>::divide
-        (const big_int& rhs, big_int*const quo) const
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        big_int<S, C, W, U>::divide(const big_int& rhs, big_int*const quo) const
     {
         const bool lmsb = msb(), rmsb = rhs.msb();
         big_int alhs, arhs;
@@ -3692,115 +7395,140 @@ namespace ecc {
         else alhs = *this;
         if (rmsb) arhs = -rhs;
         else arhs = rhs;
-        if (quo) *quo = big_int(0);
-        auto rem = big_int(0);
-        int64_t resCmp = alhs.compare(arhs);
-        if (resCmp < 0) rem = *this;
-        else if (resCmp == 0) {
-            if (quo) *quo = big_int(1);
-        } else {
-            size_t rmsvi;
-            for (size_t i = 0; i < NUMBER_OF_FIELDS; ++i) {
-                rmsvi = NUMBER_OF_FIELDS - i - 1;
-                if (arhs.fies_[rmsvi]) break;
+        size_t m = NUMBER_OF_FIELDS, n = NUMBER_OF_FIELDS;
+        while (m && !alhs.fies_[m - 1]) --m;
+        while (n && !arhs.fies_[n - 1]) --n;
+        auto q = big_int(0), rem = big_int(0);
+        if (m < n || alhs.compare(arhs) < 0) rem = alhs;
+        else if (n <= 1) {
+            uint64_t r = 0;
+            for (size_t i = 0; i < m; ++i) {
+                const size_t j = m - i - 1;
+                q.fies_[j] =
+                    divide_with_remainder(r, alhs.fies_[j], arhs.fies_[0], &r);
             }
-            std::vector<big_int> stes({arhs});
-            for (size_t i = 0; i < NUMBER_OF_FIELDS; ++i) {
-                const size_t j = NUMBER_OF_FIELDS - i - 1;
-                rem <<= LENGTH_OF_BITS_ON_FIELD;
-                rem.fies_[0] = alhs.fies_[j];
-                resCmp = rem.compare(arhs);
-                if (resCmp <= 0) {
-                    if (quo) *quo <<= LENGTH_OF_BITS_ON_FIELD;
-                    if (!resCmp) {
-                        if (quo) quo->fies_[0] = 1;
-                        rem = big_int(0);
+            rem.fies_[0] = r;
+        } else {
+            const auto dif = alhs - arhs;
+            if (dif.compare(arhs) < 0) {
+                q.fies_[0] = 1;
+                rem = dif;
+            } else {
+                size_t nor = 0;
+                while (!(arhs.fies_[n - 1] << nor >>
+                    (LENGTH_OF_BITS_ON_FIELD - 1))) ++nor;
+                uint64_t u[NUMBER_OF_FIELDS + 1], v[NUMBER_OF_FIELDS];
+                for (size_t i = 0; i < n; ++i) {
+                    v[i] = arhs.fies_[i] << nor;
+                    if (nor && i) v[i] |= arhs.fies_[i - 1] >>
+                        (LENGTH_OF_BITS_ON_FIELD - nor);
+                }
+                u[m] = nor ?
+                    alhs.fies_[m - 1] >> (LENGTH_OF_BITS_ON_FIELD - nor) : 0;
+                for (size_t i = 0; i < m; ++i) {
+                    u[i] = alhs.fies_[i] << nor;
+                    if (nor && i) u[i] |= alhs.fies_[i - 1] >>
+                        (LENGTH_OF_BITS_ON_FIELD - nor);
+                }
+                for (size_t k = 0; k <= m - n; ++k) {
+                    const size_t j = m - n - k;
+                    uint64_t qhat, rhat;
+                    bool ove = false;
+                    if (u[j + n] >= v[n - 1]) {
+                        qhat = FIELD_MASK;
+                        rhat = u[j + n - 1] + v[n - 1];
+                        ove = rhat < v[n - 1];
+                    } else qhat = divide_with_remainder
+                        (u[j + n], u[j + n - 1], v[n - 1], &rhat);
+                    while (!ove) {
+                        uint64_t hig = 0;
+                        const uint64_t low =
+                            multiply_with_carry(qhat, v[n - 2], 0, &hig);
+                        if (hig < rhat || (hig == rhat && low <= u[j + n - 2]))
+                            break;
+                        --qhat;
+                        rhat += v[n - 1];
+                        ove = rhat < v[n - 1];
                     }
-                } else {
-                    uint64_t lmsv = rem.fies_[rmsvi];
-                    if (rmsvi < NUMBER_OF_FIELDS - 1)
-                        lmsv |= rem.fies_[rmsvi + 1] <<
-                            LENGTH_OF_BITS_ON_FIELD;
-                    const uint64_t& rmsv = arhs.fies_[rmsvi];
-                    uint64_t qlsv = std::min(lmsv / rmsv, FIELD_MASK);
-                    const auto pro = arhs * big_int(qlsv);
-                    if (rem < pro) {
-                        size_t len = stes.size() - 1;
-                        bool asc = true;
-                        for (;;) {
-                            const auto nexRem = rem + stes.at(len);
-                            resCmp = nexRem.compare(pro);
-                            if (resCmp <= 0 || !len) {
-                                rem = nexRem;
-                                qlsv -= 1 << len;
-                                if (!resCmp || (resCmp > 0 && !len))
-                                    break;
-                                if (asc) {
-                                    ++len;
-                                    stes.push_back(doubling(stes.back()));
-                                } else if (len) --len;
-                            } else {
-                                --len;
-                                asc = false;
-                            }
-                        }
+                    uint64_t car = 0, bor = 0;
+                    for (size_t i = 0; i < n; ++i) {
+                        const uint64_t pro =
+                            multiply_with_carry(qhat, v[i], 0, &car);
+                        u[i + j] = subtract_with_borrow(u[i + j], pro, &bor);
                     }
-                    if (quo) {
-                        *quo <<= LENGTH_OF_BITS_ON_FIELD;
-                        quo->fies_[0] = qlsv;
+                    u[j + n] = subtract_with_borrow(u[j + n], car, &bor);
+                    if (bor) {
+                        --qhat;
+                        car = 0;
+                        for (size_t i = 0; i < n; ++i)
+                            u[i + j] = add_with_carry(u[i + j], v[i], &car);
+                        u[j + n] += car;
                     }
-                    rem -= pro;
+                    q.fies_[j] = qhat;
+                }
+                for (size_t i = 0; i < n; ++i) {
+                    rem.fies_[i] = u[i] >> nor;
+                    if (nor) rem.fies_[i] |= u[i + 1] <<
+                        (LENGTH_OF_BITS_ON_FIELD - nor);
                 }
             }
-            if (lmsb) rem = -rem;
         }
-        if (quo && lmsb != rmsb) *quo = -*quo;
+        if (lmsb) rem = -rem;
+        if (quo) *quo = lmsb != rmsb ? -q : q;
         return rem;
     }
 
-    template <size_t S, bool C> bool big_int<S, C>::msb() const {
-        return fies_[NUMBER_OF_FIELDS - 1] >>
+    template <size_t S, bool C, bool W, bool U> bool
+        big_int<S, C, W, U>::msb() const
+    {
+        return !U && fies_[NUMBER_OF_FIELDS - 1] >>
             (LENGTH_OF_BITS_ON_FIELD - 1);
     }
 
-    template <size_t S_, bool C_> std::ostream&
-        operator<<(std::ostream& os, const big_int<S_, C_>& num)
+    template <size_t S_, bool C_, bool W_, bool U_> std::ostream&
+        operator<<(std::ostream& os, const big_int<S_, C_, W_, U_>& num)
     {
+        using T = big_int<S_, C_, W_, U_>;
+        constexpr size_t
+            N = T::NUMBER_OF_FIELDS,
+            LEN_OF_BIT = N * T::LENGTH_OF_BITS_ON_FIELD;
         std::ostringstream oss;
         oss.flags(os.flags() &
             (std::ios::basefield | std::ios::uppercase));
-        if (oss.flags() & std::ios::hex) {
-            auto n = big_int<S_, C_>(num);
-            static constexpr size_t LEN =
-                big_int<S_, C_>::NUMBER_OF_FIELDS *
-                    big_int<S_, C_>::LENGTH_OF_BITS_ON_FIELD / 4;
-            for (size_t i = 0; i < LEN; ++i) {
-                oss << (n[0] & 0xf);
-                n >>= 4;
-                if (!n) break;
-            }
-        } else if (oss.flags() & std::ios::oct) {
-            auto n = big_int<S_, C_>(num);
-            static constexpr size_t LEN = (
-                big_int<S_, C_>::NUMBER_OF_FIELDS *
-                    big_int<S_, C_>::LENGTH_OF_BITS_ON_FIELD + (3 - 1)
-            ) / 3;
-            for (size_t i = 0; i < LEN; ++i) {
-                oss << (n[0] & 0x7);
-                n >>= 3;
-                if (!n) break;
-            }
+        std::string digs;
+        if (oss.flags() & (std::ios::hex | std::ios::oct)) {
+            const char*const lets = oss.flags() & std::ios::uppercase ?
+                "0123456789ABCDEF" : "0123456789abcdef";
+            const size_t wid = oss.flags() & std::ios::hex ? 4 : 3;
+            const uint64_t ext = num.msb() ? T::FIELD_MASK : 0;
+            const auto digit = [&num, &wid, &ext] (const size_t& ind) {
+                const size_t pos = ind * wid, j = pos / 64, k = pos % 64;
+                uint64_t dig = (j < N ? num[j] : ext) >> k;
+                if (k + wid > 64) dig |= (j + 1 < N ? num[j + 1] : ext) <<
+                    (64 - k);
+                return int(dig & ((uint64_t(1) << wid) - 1));
+            };
+            size_t len = (LEN_OF_BIT + wid - 1) / wid;
+            while (len > 1 && !digit(len - 1)) --len;
+            for (size_t i = 0; i < len; ++i) digs += lets[digit(i)];
         } else {
-            big_int<S_, C_> n, nn, rem, rad(10);
-            if (num < big_int<S_, C_>(0)) n = -num;
-            else n = num;
+            constexpr uint64_t CHU = 10000000000000000000ull;
+            uint64_t fies[N];
+            const T n = num < T(0) ? -num : num;
+            size_t len = N;
+            for (size_t i = 0; i < N; ++i) fies[i] = n[i];
             do {
-                nn = n / rad;
-                rem = n - rad * nn;
-                oss << rem[0];
-                n = nn;
-            } while (n);
+                while (len && !fies[len - 1]) --len;
+                uint64_t rem = divide_fields(fies, len, CHU);
+                while (len && !fies[len - 1]) --len;
+                for (size_t i = 0; i < 19 && (len || rem); ++i) {
+                    digs += char('0' + rem % 10);
+                    rem /= 10;
+                }
+            } while (len);
+            if (digs.empty()) digs = "0";
         }
+        oss << digs;
         if (os.flags() & std::ios::internal) {
             int wid = os.width() - oss.tellp();
             if (os.flags() & std::ios::showbase) {
@@ -3808,7 +7536,10 @@ namespace ecc {
                 if (os.flags() & (std::ios::hex | std::ios::oct)) --wid;
             }
             if (os.flags() & std::ios::dec &&
-                ((os.flags() & std::ios::showpos) || num < big_int<S_, C_>(0))
+                (
+                    (os.flags() & std::ios::showpos) ||
+                    num < big_int<S_, C_, W_, U_>(0)
+                )
             ) --wid;
             if (wid > 0) {
                 for (size_t i = 0; i < wid; ++i) oss << os.fill();
@@ -3822,7 +7553,7 @@ namespace ecc {
             if (os.flags() & (std::ios::hex | std::ios::oct)) oss << '0';
         }
         if (os.flags() & std::ios::dec) {
-            if (num < big_int<S_, C_>(0)) oss << '-';
+            if (num < big_int<S_, C_, W_, U_>(0)) oss << '-';
             else if (os.flags() & std::ios::showpos) oss << '+';
         }
         std::string str = oss.str();
@@ -3830,61 +7561,272 @@ namespace ecc {
         return os << str;
     }
 
-    template <size_t S_, bool C_> std::istream&
-        operator>>(std::istream& is, big_int<S_, C_>& num)
+    template <size_t S_, bool C_, bool W_, bool U_> std::istream&
+        operator>>(std::istream& is, big_int<S_, C_, W_, U_>& num)
     {
         std::string str;
         is >> str;
-        num = big_int<S_, C_>(str, is.flags() & std::ios::basefield);
+        num = big_int<S_, C_, W_, U_>(str, is.flags() & std::ios::basefield);
         return is;
     }
 
-    template <size_t S, bool C> constexpr size_t
-        LOGICAL_SIZE_OF_SPECIALIZED(const big_int<S, C>& val)
+    template <typename N, size_t L> big_int_batch<N, L>::big_int_batch() :
+        digs_() {}
+
+    template <typename N, size_t L> big_int_batch<N, L>::big_int_batch
+        (const N& num)
     {
-        return big_int<S, C>::LOGICAL_SIZE;
+        for (size_t i = 0; i < L; ++i) set(i, num);
     }
 
-    template <size_t S, bool O, size_t Z, bool C> big_int<Z, C>
-        bytes_to_number_specialized
-            (const big_int<Z, C>& val, const get_byte& getByt)
-    {
-        static constexpr size_t
-            QUO = S / big_int<Z>::SIZE_OF_FIELD,
-            REM = S % big_int<Z>::SIZE_OF_FIELD;
-        auto num = big_int<Z>(0);
-        if (O) {
-            num[QUO] = bytes_to_number<uint64_t, REM, O>(getByt);
-            for (size_t i = 0; i < QUO; ++i)
-                num[QUO - i - 1] = bytes_to_number
-                    <uint64_t, big_int<Z>::SIZE_OF_FIELD, O>(getByt);
-        } else {
-            for (size_t i = 0; i < QUO; ++i)
-                num[i] = bytes_to_number
-                    <uint64_t, big_int<Z>::SIZE_OF_FIELD, O>(getByt);
-            num[QUO] = bytes_to_number<uint64_t, REM, O>(getByt);
+    template <typename N, size_t L> N big_int_batch<N, L>::get
+        (const size_t& lan) const
+    {
+        N res(0);
+        for (size_t i = 0; i < N::NUMBER_OF_FIELDS; ++i) res[i] =
+            digs_[2 * i * L + lan] | (digs_[(2 * i + 1) * L + lan] << 32);
+        return res;
+    }
+
+    template <typename N, size_t L> void big_int_batch<N, L>::set
+        (const size_t& lan, const N& num)
+    {
+        for (size_t i = 0; i < N::NUMBER_OF_FIELDS; ++i) {
+            digs_[2 * i * L + lan] = num[i] & 0xffffffff;
+            digs_[(2 * i + 1) * L + lan] = num[i] >> 32;
         }
-        return num;
     }
 
-    template <size_t S, bool O, size_t Z, bool C>
-        void number_to_bytes_specialized
-            (const big_int<Z, C>& num, const put_byte& putByt)
-    {
-        static constexpr size_t
-            QUO = S / big_int<Z>::SIZE_OF_FIELD,
-            REM = S % big_int<Z>::SIZE_OF_FIELD;
-        if (O) {
-            number_to_bytes<uint64_t, REM, O>(num[QUO], putByt);
-            for (size_t i = 0; i < QUO; ++i)
-                number_to_bytes<uint64_t, big_int<Z>::SIZE_OF_FIELD, O>
-                    (num[QUO - i - 1], putByt);
-        } else {
-            for (size_t i = 0; i < QUO; ++i)
-                number_to_bytes<uint64_t, big_int<Z>::SIZE_OF_FIELD, O>
-                    (num[i], putByt);
-            number_to_bytes<uint64_t, REM, O>(num[QUO], putByt);
+    template <typename N, size_t L> big_int_batch<N, L>
+        big_int_batch<N, L>::operator*(const big_int_batch& rhs) const
+    {
+        constexpr size_t D = NUMBER_OF_DIGITS;
+        big_int_batch res;
+        kernels_for_batch().multiply(digs_, rhs.digs_, D, L, res.digs_);
+        return res;
+    }
+
+    template <typename N, size_t L> big_int_batch<N, L>
+        big_int_batch<N, L>::operator+(const big_int_batch& rhs) const
+    {
+        constexpr size_t D = NUMBER_OF_DIGITS;
+        big_int_batch res;
+        kernels_for_batch().add(digs_, rhs.digs_, D, L, res.digs_);
+        return res;
+    }
+
+    template <typename N, size_t L> big_int_batch<N, L>
+        big_int_batch<N, L>::operator-(const big_int_batch& rhs) const
+    {
+        constexpr size_t D = NUMBER_OF_DIGITS;
+        big_int_batch res;
+        kernels_for_batch().subtract(digs_, rhs.digs_, D, L, res.digs_);
+        return res;
+    }
+
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, true, U>
+        multiply_wide
+            (const big_int<S, C, W, U>& lhs, const big_int<S, C, W, U>& rhs)
+    {
+        constexpr size_t N = big_int<S, C, W, U>::NUMBER_OF_FIELDS;
+        const bool
+            lmsb = !U && lhs < big_int<S, C, W, U>(0),
+            rmsb = !U && rhs < big_int<S, C, W, U>(0);
+        const auto
+            alhs = lmsb ? -lhs : lhs,
+            arhs = rmsb ? -rhs : rhs;
+        uint64_t pro[2 * N];
+        multiply_fields_karatsuba<N>(&alhs[0], &arhs[0], pro);
+        auto res = big_int<S, C, true, U>(0);
+        for (size_t i = 0; i < big_int<S, C, true, U>::NUMBER_OF_FIELDS; ++i)
+            res[i] = i < 2 * N ? pro[i] : 0;
+        return lmsb != rmsb ? -res : res;
+    }
+
+    template <size_t S, bool C, bool W, bool U, bool U_>
+        big_int<S, C, false, U_> reduce_wide(
+            const big_int<S, C, W, U>& num,
+            const big_int<S, C, false, U_>& mod
+        )
+    {
+        const auto wmod = big_int<S, C, W, U>(mod);
+        auto res = num % wmod;
+        if (!U && res < big_int<S, C, W, U>(0)) res += wmod;
+        return big_int<S, C, false, U_>(res);
+    }
+
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        add_modulo(
+            const big_int<S, C, W, U>& lhs,
+            const big_int<S, C, W, U>& rhs,
+            const big_int<S, C, W, U>& mod
+        )
+    {
+        constexpr size_t N = big_int<S, C, W, U>::NUMBER_OF_FIELDS;
+        big_int<S, C, W, U> sum, dif;
+        uint64_t car = 0, bor = 0;
+        for (size_t i = 0; i < N; ++i) {
+            sum[i] = add_with_carry(lhs[i], rhs[i], &car);
+            dif[i] = subtract_with_borrow(sum[i], mod[i], &bor);
+        }
+        const uint64_t mas = 0 - (bor & ~car);
+        for (size_t i = 0; i < N; ++i)
+            dif[i] = (sum[i] & mas) | (dif[i] & ~mas);
+        return dif;
+    }
+
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        subtract_modulo(
+            const big_int<S, C, W, U>& lhs,
+            const big_int<S, C, W, U>& rhs,
+            const big_int<S, C, W, U>& mod
+        )
+    {
+        constexpr size_t N = big_int<S, C, W, U>::NUMBER_OF_FIELDS;
+        big_int<S, C, W, U> dif;
+        uint64_t bor = 0, car = 0;
+        for (size_t i = 0; i < N; ++i)
+            dif[i] = subtract_with_borrow(lhs[i], rhs[i], &bor);
+        const uint64_t mas = 0 - bor;
+        for (size_t i = 0; i < N; ++i)
+            dif[i] = add_with_carry(dif[i], mod[i] & mas, &car);
+        return dif;
+    }
+
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        halve_modulo
+            (const big_int<S, C, W, U>& num, const big_int<S, C, W, U>& mod)
+    {
+        constexpr size_t N = big_int<S, C, W, U>::NUMBER_OF_FIELDS;
+        big_int<S, C, W, U> res;
+        const uint64_t mas = 0 - (num[0] & 1);
+        uint64_t car = 0;
+        for (size_t i = 0; i < N; ++i)
+            res[i] = add_with_carry(num[i], mod[i] & mas, &car);
+        for (size_t i = 0; i + 1 < N; ++i)
+            res[i] = (res[i] >> 1) | (res[i + 1] << 63);
+        res[N - 1] = (res[N - 1] >> 1) | (car << 63);
+        return res;
+    }
+
+    template <size_t S, bool C, bool W, bool U>
+        size_t capacity_of_products(const big_int<S, C, W, U>& mod)
+    {
+        using wide_int = typename wide<big_int<S, C, W, U>>::type;
+        constexpr size_t BITS = big_int<S, C, W, U>::LENGTH_OF_BITS_ON_FIELD;
+        size_t len = big_int<S, C, W, U>::NUMBER_OF_FIELDS * BITS;
+        while (len && !(mod[(len - 1) / BITS] >> ((len - 1) % BITS) & 1))
+            --len;
+        const size_t spa = wide_int::NUMBER_OF_FIELDS * BITS - 2 * len;
+        return size_t(1) << std::min(spa, 8 * sizeof(size_t) - 2);
+    }
+
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        invert_modulo
+            (const big_int<S, C, W, U>& num, const big_int<S, C, W, U>& mod)
+    {
+        constexpr size_t N = big_int<S, C, W, U>::NUMBER_OF_FIELDS;
+        const auto halve = [&mod] (uint64_t*const val, uint64_t*const coe) {
+            while (!(val[0] & 1)) {
+                for (size_t i = 0; i + 1 < N; ++i)
+                    val[i] = (val[i] >> 1) | (val[i + 1] << 63);
+                val[N - 1] >>= 1;
+                const uint64_t mas = 0 - (coe[0] & 1);
+                uint64_t car = 0;
+                for (size_t i = 0; i < N; ++i)
+                    coe[i] = add_with_carry(coe[i], mod[i] & mas, &car);
+                for (size_t i = 0; i + 1 < N; ++i)
+                    coe[i] = (coe[i] >> 1) | (coe[i + 1] << 63);
+                coe[N - 1] = (coe[N - 1] >> 1) | (car << 63);
+            }
+        };
+        const auto reduce = [&mod] (
+            uint64_t*const lhv,
+            const uint64_t*const rhv,
+            uint64_t*const lhc,
+            const uint64_t*const rhc
+        ) {
+            uint64_t bor = 0, car = 0, any = 0;
+            for (size_t i = 0; i < N; ++i) {
+                lhv[i] = subtract_with_borrow(lhv[i], rhv[i], &bor);
+                any |= lhv[i];
+            }
+            bor = 0;
+            for (size_t i = 0; i < N; ++i)
+                lhc[i] = subtract_with_borrow(lhc[i], rhc[i], &bor);
+            const uint64_t mas = 0 - bor;
+            for (size_t i = 0; i < N; ++i)
+                lhc[i] = add_with_carry(lhc[i], mod[i] & mas, &car);
+            return any != 0;
+        };
+        const auto is_one = [] (const uint64_t*const val) {
+            uint64_t any = val[0] ^ 1;
+            for (size_t i = 1; i < N; ++i) any |= val[i];
+            return !any;
+        };
+        auto res = big_int<S, C, W, U>(0);
+        if (!num) return res;
+        uint64_t u[N], v[N], x[N], y[N];
+        for (size_t i = 0; i < N; ++i) {
+            u[i] = num[i];
+            v[i] = mod[i];
+            x[i] = y[i] = 0;
+        }
+        x[0] = 1;
+        const uint64_t* coe = nullptr;
+        for (;;) {
+            halve(u, x);
+            if (is_one(u)) {
+                coe = x;
+                break;
+            }
+            halve(v, y);
+            if (is_one(v)) {
+                coe = y;
+                break;
+            }
+            size_t i = N;
+            while (i && u[i - 1] == v[i - 1]) --i;
+            const bool gre = !i || u[i - 1] > v[i - 1];
+            if (!(gre ? reduce(u, v, x, y) : reduce(v, u, y, x))) break;
         }
+        if (coe) for (size_t i = 0; i < N; ++i) res[i] = coe[i];
+        return res;
+    }
+
+    template <size_t S, bool C, bool W, bool U> big_int<S, C, W, U>
+        square(const big_int<S, C, W, U>& num)
+    {
+        constexpr size_t N = big_int<S, C, W, U>::NUMBER_OF_FIELDS;
+        const auto abs = num < big_int<S, C, W, U>(0) ? -num : num;
+        size_t len = N;
+        while (len && !abs[len - 1]) --len;
+        uint64_t pro[2 * N];
+        kernels().square(&abs[0], len, pro);
+        auto res = big_int<S, C, W, U>(0);
+        for (size_t i = 0; i < N && i < 2 * len; ++i) res[i] = pro[i];
+        return res;
+    }
+
+    template <size_t S, bool C, bool W, bool U> constexpr size_t
+        LOGICAL_SIZE_OF_SPECIALIZED(const big_int<S, C, W, U>& val)
+    {
+        return big_int<S, C, W, U>::LOGICAL_SIZE;
+    }
+
+    template <size_t S, bool O, size_t Z, bool C, bool W, bool U>
+        big_int<Z, C, W, U>
+        bytes_to_number_specialized
+            (const big_int<Z, C, W, U>&, const uint8_t*const byts)
+    {
+        return big_int<Z, C, W, U>::from_bytes(byts, S, O);
+    }
+
+    template <size_t S, bool O, size_t Z, bool C, bool W, bool U>
+        void number_to_bytes_specialized
+            (const big_int<Z, C, W, U>& num, uint8_t*const byts)
+    {
+        num.to_bytes(byts, S, O);
     }
 
     //---- helper definition ----
@@ -3919,15 +7861,17 @@ namespace ecc {
     template <typename V, size_t S, bool O> V
         bytes_to_number(const get_byte& getByt)
     {
-        return bytes_to_number_specialized<S, O>(V(), getByt);
+        uint8_t byts[S];
+        for (size_t i = 0; i < S; ++i) byts[i] = uint8_t(getByt());
+        return bytes_to_number_specialized<S, O>(V(), byts);
     }
 
     template <size_t S, bool O, typename V> V
-        bytes_to_number_specialized(const V& val, const get_byte& getByt)
+        bytes_to_number_specialized(const V&, const uint8_t*const byts)
     {
         auto num = V(0);
         for (size_t i = 0; i < S; ++i) {
-            const auto byt = V(getByt());
+            const auto byt = V(byts[i]);
             if (O) num = (num << 8) | byt;
             else if (i < LOGICAL_SIZE_OF<V>()) num |= byt << (8 * i);
         }
@@ -3942,6 +7886,13 @@ namespace ecc {
         };
     }
 
+    template <typename V, size_t S, bool O> void bytes_to_numbers
+        (const uint8_t*const byts, const size_t& cou, V*const nums)
+    {
+        for (size_t i = 0; i < cou; ++i)
+            nums[i] = bytes_to_number_specialized<S, O>(V(), byts + S * i);
+    }
+
     template <typename I, typename O> value_to_value<I, O> cast() {
         return [] (
             const get_value<I>& getVal,
@@ -3982,6 +7933,69 @@ namespace ecc {
         return val + val;
     }
 
+    template <typename T, typename E, class M, class Q> T exponentiate(
+        const T& bas,
+        const E& exp,
+        const T& one,
+        const M& mul,
+        const Q& squ
+    ) {
+        std::vector<bool> bits;
+        number_to_bits
+            (exp, make_putter_from_iterator<bool>(std::back_inserter(bits)));
+        auto ite = std::find(bits.begin(), bits.end(), true);
+        const size_t len = bits.end() - ite;
+        if (!len) return one;
+        const size_t wid =
+            len > 512 ? 6 : len > 160 ? 5 : len > 48 ? 4 : len > 12 ? 3 : 1;
+        std::vector<T> pows(size_t(1) << (wid - 1), bas);
+        if (wid > 1) {
+            const T squOfBas = squ(bas);
+            for (size_t i = 1; i < pows.size(); ++i)
+                pows[i] = mul(pows[i - 1], squOfBas);
+        }
+        T res = one;
+        bool fir = true;
+        while (ite != bits.end()) {
+            if (!*ite) {
+                res = squ(res);
+                ++ite;
+                continue;
+            }
+            auto las = ite + std::min(wid, size_t(bits.end() - ite));
+            while (!*(las - 1)) --las;
+            size_t dig = 0;
+            for (; ite != las; ++ite) {
+                dig = (dig << 1) | size_t(*ite);
+                if (!fir) res = squ(res);
+            }
+            res = fir ? pows[dig >> 1] : mul(res, pows[dig >> 1]);
+            fir = false;
+        }
+        return res;
+    }
+
+    template <typename T, size_t N, class M, class Q>
+        T exponentiate_with_chain(
+            const T& bas,
+            const addition_chain_step (&cha)[N],
+            const M& mul,
+            const Q& squ
+        )
+    {
+        constexpr size_t NO_MUL = addition_chain_step::NO_MULTIPLIER;
+        T vals[N + 1];
+        vals[0] = bas;
+        for (size_t i = 0; i < N; ++i) {
+            const addition_chain_step& ste = cha[i];
+            T val = vals[ste.source];
+            for (size_t j = 0; j < ste.squarings; ++j) val = squ(val);
+            vals[i + 1] = ste.multiplier == NO_MUL ?
+                val : mul(val, vals[ste.multiplier]);
+        }
+        return vals[N];
+    }
+
     template <typename V> V fit_within_range
         (const V& num, const V& min, const V& max)
     {
@@ -3995,6 +8009,57 @@ namespace ecc {
         return res;
     }
 
+    template <size_t N> void fold_pseudo_mersenne(
+        uint64_t*const num,
+        const size_t& lenOfBit,
+        const uint64_t*const dif,
+        const size_t& lenOfDif,
+        const uint64_t*const ord
+    ) {
+        const size_t
+            quo = lenOfBit / 64,
+            rem = lenOfBit % 64;
+        size_t len = 2 * N;
+        for (;;) {
+            while (len && !num[len - 1]) --len;
+            if (len <= quo || (len == quo + 1 && !(num[quo] >> rem)))
+                break;
+            uint64_t hig[2 * N];
+            const size_t lenOfHig = len - quo;
+            for (size_t i = 0; i < lenOfHig; ++i) {
+                hig[i] = num[quo + i];
+                if (rem) {
+                    hig[i] >>= rem;
+                    if (quo + i + 1 < len)
+                        hig[i] |= num[quo + i + 1] << (64 - rem);
+                }
+            }
+            for (size_t i = quo; i < len; ++i) {
+                if (i == quo && rem) num[i] &= (uint64_t(1) << rem) - 1;
+                else num[i] = 0;
+            }
+            for (size_t i = 0; i < lenOfDif; ++i) {
+                uint64_t car = 0;
+                for (size_t j = 0; j < lenOfHig; ++j) num[i + j] =
+                    multiply_with_carry(hig[j], dif[i], num[i + j], &car);
+                for (size_t j = i + lenOfHig; car && j < 2 * N; ++j) {
+                    uint64_t sum = 0;
+                    num[j] = add_with_carry(num[j], car, &sum);
+                    car = sum;
+                }
+            }
+            len = 2 * N;
+        }
+        for (;;) {
+            size_t i = N;
+            while (i && num[i - 1] == ord[i - 1]) --i;
+            if (i && num[i - 1] < ord[i - 1]) break;
+            uint64_t bor = 0;
+            for (size_t j = 0; j < N; ++j)
+                num[j] = subtract_with_borrow(num[j], ord[j], &bor);
+        }
+    }
+
     template <typename V> V gcdm
         (const V& a, const V& b, V*const x, V*const y)
     {
@@ -4088,21 +8153,22 @@ namespace ecc {
     template <typename V, size_t S, bool O>
         void number_to_bytes(const V& num, const put_byte& putByt)
     {
-        number_to_bytes_specialized<S, O>(num, putByt);
+        uint8_t byts[S];
+        number_to_bytes_specialized<S, O>(num, byts);
+        for (size_t i = 0; i < S; ++i) putByt(byts[i]);
     }
 
     template <size_t S, bool O, typename V>
-        void number_to_bytes_specialized
-            (const V& num, const put_byte& putByt)
+        void number_to_bytes_specialized(const V& num, uint8_t*const byts)
     {
         for (size_t i = 0; i < S; ++i) {
             if (O) {
                 const size_t j = S - i - 1;
-                if (j >= LOGICAL_SIZE_OF<V>()) putByt(0);
-                else putByt(int(num >> (8 * (S - i - 1))) & 0xff);
+                if (j >= LOGICAL_SIZE_OF<V>()) byts[i] = 0;
+                else byts[i] = uint8_t(int(num >> (8 * j)) & 0xff);
             } else {
-                if (i >= LOGICAL_SIZE_OF<V>()) putByt(0);
-                else putByt(int(num >> (8 * i)) & 0xff);
+                if (i >= LOGICAL_SIZE_OF<V>()) byts[i] = 0;
+                else byts[i] = uint8_t(int(num >> (8 * i)) & 0xff);
             }
         }
     }
@@ -4115,6 +8181,66 @@ namespace ecc {
         };
     }
 
+    template <typename V, size_t S, bool O> void numbers_to_bytes
+        (const V*const nums, const size_t& cou, uint8_t*const byts)
+    {
+        for (size_t i = 0; i < cou; ++i)
+            number_to_bytes_specialized<S, O>(nums[i], byts + S * i);
+    }
+
+    template <typename V> V pow_modulo
+        (const V& num, const V& exp, const V& mod)
+    {
+        return exponentiate(
+            num,
+            exp,
+            V(1) % mod,
+            [&mod] (const V& lhs, const V& rhs) {
+                return lhs * rhs % mod;
+            },
+            [&mod] (const V& val) {
+                return val * val % mod;
+            }
+        );
+    }
+
+    template <typename V> V add_modulo
+        (const V& lhs, const V& rhs, const V& mod)
+    {
+        const V sum = lhs + rhs;
+        return sum < mod ? sum : sum - mod;
+    }
+
+    template <typename V> size_t capacity_of_products(const V&) {
+        return 2;
+    }
+
+    template <typename V> V subtract_modulo
+        (const V& lhs, const V& rhs, const V& mod)
+    {
+        return lhs < rhs ? lhs + (mod - rhs) : lhs - rhs;
+    }
+
+    template <typename V> V halve_modulo(const V& num, const V& mod) {
+        return num % V(2) ? num / V(2) + mod / V(2) + V(1) : num / V(2);
+    }
+
+    template <typename V> V invert_modulo(const V& num, const V& mod) {
+        V x, y;
+        gcdm(mod, num, &x, &y);
+        return reduce_wide(y, mod);
+    }
+
+    template <typename V> V multiply_wide(const V& lhs, const V& rhs) {
+        return lhs * rhs;
+    }
+
+    template <typename V> V reduce_wide(const V& num, const V& mod) {
+        V res = num % mod;
+        if (res < V(0)) res += mod;
+        return res;
+    }
+
     template <typename V> auto square(const V& val) -> decltype(val*val) {
         return val * val;
     }
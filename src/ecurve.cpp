@@ -0,0 +1,353 @@
+#include "eccrypto.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace ecc {
+    namespace {
+        constexpr uint64_t LIMB_MASK = (uint64_t(1) << 52) - 1;
+
+        constexpr size_t NO_MULTIPLIER = addition_chain_step::NO_MULTIPLIER;
+
+        const uint64_t SECP256R1_LIMBS[] = {
+            0x000fffffffffffffull,
+            0x00000fffffffffffull,
+            0x0000000000000000ull,
+            0x0000001000000000ull,
+            0x0000ffffffff0000ull
+        };
+
+        inline uint64_t shift_limb(uint64_t*const acc) {
+            const uint64_t res = acc[0] & LIMB_MASK;
+            acc[0] = acc[0] >> 52 | acc[1] << 12;
+            acc[1] = acc[1] >> 52 | acc[2] << 12;
+            acc[2] >>= 52;
+            return res;
+        }
+
+        template <size_t... KS> inline void multiply_limb_columns(
+            const uint64_t*const lhs,
+            const uint64_t*const rhs,
+            uint64_t*const lim,
+            std::index_sequence<KS...>
+        ) {
+            uint64_t acc[3] = {0, 0, 0};
+            const int seq[] = {
+                0,
+                (
+                    multiply_column<5, KS>(
+                        lhs,
+                        rhs,
+                        acc,
+                        std::make_index_sequence<(KS < 5 ? KS + 1 : 9 - KS)>()
+                    ),
+                    lim[KS] = shift_limb(acc),
+                    0
+                )...
+            };
+            (void)seq;
+            lim[9] = acc[0];
+        }
+
+        template <size_t... KS> inline void square_limb_columns(
+            const uint64_t*const val,
+            uint64_t*const lim,
+            std::index_sequence<KS...>
+        ) {
+            const uint64_t dbl[] = {
+                val[0] << 1,
+                val[1] << 1,
+                val[2] << 1,
+                val[3] << 1,
+                val[4] << 1
+            };
+            uint64_t acc[3] = {0, 0, 0};
+            const int seq[] = {
+                0,
+                (
+                    multiply_column<5, KS>(
+                        val,
+                        dbl,
+                        acc,
+                        std::make_index_sequence
+                            <(KS < 5 ? (KS + 1) / 2 : (KS - 1) / 2 + 5 - KS)>()
+                    ),
+                    KS % 2 ? 0 : (
+                        multiply_accumulate(val[KS / 2], val[KS / 2], acc),
+                        0
+                    ),
+                    lim[KS] = shift_limb(acc),
+                    0
+                )...
+            };
+            (void)seq;
+            lim[9] = acc[0];
+        }
+
+        template <size_t... KS> inline void montgomery_reduce_limbs(
+            const uint64_t*const lim,
+            const uint64_t*const ord,
+            uint64_t*const pro,
+            std::index_sequence<KS...>
+        ) {
+            uint64_t m[5], acc[3] = {0, 0, 0};
+            const int seq[] = {
+                0,
+                (
+                    acc[0] += lim[KS],
+                    acc[1] += acc[0] < lim[KS],
+                    multiply_column<5, KS>(
+                        m,
+                        ord,
+                        acc,
+                        std::make_index_sequence<(KS < 5 ? KS : 9 - KS)>()
+                    ),
+                    KS < 5 ? (
+                        m[KS % 5] = acc[0] & LIMB_MASK,
+                        multiply_accumulate(m[KS % 5], ord[0], acc),
+                        shift_limb(acc)
+                    ) : (pro[(KS + 5) % 10] = shift_limb(acc)),
+                    0
+                )...
+            };
+            (void)seq;
+            pro[4] = acc[0] + lim[9];
+        }
+
+        inline void fold_limbs(uint64_t*const lim, const uint64_t*const fol) {
+            for (size_t i = 0; i < 4; ++i) {
+                lim[i + 1] += lim[i] >> 52;
+                lim[i] &= LIMB_MASK;
+            }
+            const uint64_t top = lim[4] >> 48;
+            lim[4] &= (uint64_t(1) << 48) - 1;
+            for (size_t i = 0; i < 5; ++i) lim[i] += top * fol[i];
+            for (size_t i = 0; i < 4; ++i) {
+                lim[i + 1] += lim[i] >> 52;
+                lim[i] &= LIMB_MASK;
+            }
+        }
+
+        inline void reduce_secp256k1_limbs
+            (const uint64_t*const lim, uint64_t*const pro)
+        {
+            constexpr uint64_t DIF = 0x0000001000003d10ull;
+            uint64_t acc[3] = {0, 0, 0};
+            for (size_t i = 0; i < 5; ++i) {
+                acc[0] += lim[i];
+                acc[1] += acc[0] < lim[i];
+                multiply_accumulate(lim[i + 5], DIF, acc);
+                pro[i] = shift_limb(acc);
+            }
+            uint64_t hig = 0;
+            const uint64_t low = multiply_with_carry(acc[0], DIF, pro[0], &hig);
+            pro[0] = low & LIMB_MASK;
+            pro[1] += low >> 52 | hig << 12;
+            secp256k1::normalize_limbs(pro);
+        }
+    }
+
+    constexpr uint64_t secp160r1::ORDER[NUMBER_OF_FIELDS];
+
+    void secp160r1::reduce(uint64_t*const num) {
+        static const uint64_t DIF[] = {0x0000000080000001ull};
+        fold_pseudo_mersenne<NUMBER_OF_FIELDS>(num, 160, DIF, 1, ORDER);
+    }
+
+    constexpr uint64_t secp192r1::ORDER[NUMBER_OF_FIELDS];
+
+    void secp192r1::reduce(uint64_t*const num) {
+        static const uint64_t DIF[] = {
+            0x0000000000000001ull,
+            0x0000000000000001ull
+        };
+        fold_pseudo_mersenne<NUMBER_OF_FIELDS>(num, 192, DIF, 2, ORDER);
+    }
+
+    constexpr uint64_t secp224r1::ORDER[NUMBER_OF_FIELDS];
+
+    void secp224r1::reduce(uint64_t*const num) {
+        static const uint64_t DIF[] = {
+            0xffffffffffffffffull,
+            0x00000000ffffffffull
+        };
+        fold_pseudo_mersenne<NUMBER_OF_FIELDS>(num, 224, DIF, 2, ORDER);
+    }
+
+    constexpr uint64_t secp256r1::ORDER[NUMBER_OF_FIELDS];
+
+    const addition_chain_step
+        secp256r1::INVERSION_CHAIN[LENGTH_OF_INVERSION_CHAIN] =
+    {
+        {0, 1, 0}, {1, 1, 0}, {2, 3, 2}, {3, 6, 3},
+        {4, 3, 2}, {5, 15, 5}, {6, 2, 1}, {7, 32, 0},
+        {8, 128, 7}, {9, 32, 7}, {10, 30, 6}, {11, 2, 0}
+    };
+
+    const addition_chain_step
+        secp256r1::SQUARE_ROOT_CHAIN[LENGTH_OF_SQUARE_ROOT_CHAIN] =
+    {
+        {0, 1, 0}, {1, 1, 0}, {2, 3, 2}, {3, 6, 3},
+        {4, 3, 2}, {5, 15, 5}, {6, 2, 1}, {7, 32, 0},
+        {8, 96, 0}, {9, 94, NO_MULTIPLIER}
+    };
+
+    void secp256r1::reduce(uint64_t*const num) {
+        int64_t a[16];
+        for (size_t i = 0; i < 16; ++i)
+            a[i] = int64_t((num[i / 2] >> (32 * (i % 2))) & 0xffffffff);
+        int64_t acc[9] = {
+            a[0] + a[8] + a[9] - a[11] - a[12] - a[13] - a[14],
+            a[1] + a[9] + a[10] - a[12] - a[13] - a[14] - a[15],
+            a[2] + a[10] + a[11] - a[13] - a[14] - a[15],
+            a[3] + 2 * a[11] + 2 * a[12] + a[13] - a[15] - a[8] - a[9],
+            a[4] + 2 * a[12] + 2 * a[13] + a[14] - a[9] - a[10],
+            a[5] + 2 * a[13] + 2 * a[14] + a[15] - a[10] - a[11],
+            a[6] + 3 * a[14] + 2 * a[15] + a[13] - a[8] - a[9],
+            a[7] + 3 * a[15] + a[8] - a[10] - a[11] - a[12] - a[13],
+            0
+        };
+        for (size_t i = 0; i < 8; ++i) {
+            acc[i + 1] += acc[i] >> 32;
+            acc[i] &= 0xffffffff;
+        }
+        for (size_t i = 0; i < 4; ++i)
+            num[i] = uint64_t(acc[2 * i]) | (uint64_t(acc[2 * i + 1]) << 32);
+        int64_t top = acc[8];
+        while (top < 0) {
+            uint64_t car = 0;
+            for (size_t i = 0; i < 4; ++i)
+                num[i] = add_with_carry(num[i], ORDER[i], &car);
+            top += int64_t(car);
+        }
+        for (;;) {
+            if (!top) {
+                size_t i = 4;
+                while (i && num[i - 1] == ORDER[i - 1]) --i;
+                if (i && num[i - 1] < ORDER[i - 1]) break;
+            }
+            uint64_t bor = 0;
+            for (size_t i = 0; i < 4; ++i)
+                num[i] = subtract_with_borrow(num[i], ORDER[i], &bor);
+            top -= int64_t(bor);
+        }
+        for (size_t i = 4; i < 8; ++i) num[i] = 0;
+    }
+
+    void secp256r1::normalize_limbs(uint64_t*const lim) {
+        static const uint64_t FOL[NUMBER_OF_LIMBS] = {
+            0x0000000000000001ull,
+            0x000ff00000000000ull,
+            0x000fffffffffffffull,
+            0x000fffefffffffffull,
+            0x000000000000ffffull
+        };
+        fold_limbs(lim, FOL);
+    }
+
+    void secp256r1::multiply_limbs(
+        const uint64_t*const lhs,
+        const uint64_t*const rhs,
+        uint64_t*const pro
+    ) {
+        uint64_t lim[10];
+        multiply_limb_columns(lhs, rhs, lim, std::make_index_sequence<9>());
+        montgomery_reduce_limbs
+            (lim, SECP256R1_LIMBS, pro, std::make_index_sequence<9>());
+    }
+
+    void secp256r1::square_limbs
+        (const uint64_t*const val, uint64_t*const pro)
+    {
+        uint64_t lim[10];
+        square_limb_columns(val, lim, std::make_index_sequence<9>());
+        montgomery_reduce_limbs
+            (lim, SECP256R1_LIMBS, pro, std::make_index_sequence<9>());
+    }
+
+    constexpr uint64_t secp384r1::ORDER[NUMBER_OF_FIELDS];
+
+    void secp384r1::reduce(uint64_t*const num) {
+        static const uint64_t DIF[] = {
+            0xffffffff00000001ull,
+            0x00000000ffffffffull,
+            0x0000000000000001ull
+        };
+        fold_pseudo_mersenne<NUMBER_OF_FIELDS>(num, 384, DIF, 3, ORDER);
+    }
+
+    constexpr uint64_t secp521r1::ORDER[NUMBER_OF_FIELDS];
+
+    const addition_chain_step
+        secp521r1::INVERSION_CHAIN[LENGTH_OF_INVERSION_CHAIN] =
+    {
+        {0, 1, 0}, {1, 1, 0}, {1, 2, 1}, {3, 4, 3},
+        {4, 8, 4}, {5, 16, 5}, {6, 32, 6}, {7, 64, 7},
+        {8, 128, 8}, {9, 256, 9}, {3, 3, 2}, {10, 7, 11},
+        {12, 2, 0}
+    };
+
+    const addition_chain_step
+        secp521r1::SQUARE_ROOT_CHAIN[LENGTH_OF_SQUARE_ROOT_CHAIN] =
+    {
+        {0, 519, NO_MULTIPLIER}
+    };
+
+    void secp521r1::reduce(uint64_t*const num) {
+        static const uint64_t DIF[] = {0x0000000000000001ull};
+        fold_pseudo_mersenne<NUMBER_OF_FIELDS>(num, 521, DIF, 1, ORDER);
+    }
+
+    constexpr uint64_t secp256k1::ORDER[NUMBER_OF_FIELDS];
+
+    const addition_chain_step
+        secp256k1::INVERSION_CHAIN[LENGTH_OF_INVERSION_CHAIN] =
+    {
+        {0, 1, 0}, {1, 1, 0}, {2, 3, 2}, {3, 3, 2},
+        {4, 2, 1}, {5, 11, 5}, {6, 22, 6}, {7, 44, 7},
+        {8, 88, 8}, {9, 44, 7}, {10, 3, 2}, {11, 23, 6},
+        {12, 5, 0}, {13, 3, 1}, {14, 2, 0}
+    };
+
+    const addition_chain_step
+        secp256k1::SQUARE_ROOT_CHAIN[LENGTH_OF_SQUARE_ROOT_CHAIN] =
+    {
+        {0, 1, 0}, {1, 1, 0}, {2, 3, 2}, {3, 3, 2},
+        {4, 2, 1}, {5, 11, 5}, {6, 22, 6}, {7, 44, 7},
+        {8, 88, 8}, {9, 44, 7}, {10, 3, 2}, {11, 23, 6},
+        {12, 6, 1}, {13, 2, NO_MULTIPLIER}
+    };
+
+    void secp256k1::reduce(uint64_t*const num) {
+        static const uint64_t DIF[] = {0x00000001000003d1ull};
+        fold_pseudo_mersenne<NUMBER_OF_FIELDS>(num, 256, DIF, 1, ORDER);
+    }
+
+    void secp256k1::normalize_limbs(uint64_t*const lim) {
+        static const uint64_t FOL[NUMBER_OF_LIMBS] = {
+            0x00000001000003d1ull,
+            0x0000000000000000ull,
+            0x0000000000000000ull,
+            0x0000000000000000ull,
+            0x0000000000000000ull
+        };
+        fold_limbs(lim, FOL);
+    }
+
+    void secp256k1::multiply_limbs(
+        const uint64_t*const lhs,
+        const uint64_t*const rhs,
+        uint64_t*const pro
+    ) {
+        uint64_t lim[10];
+        multiply_limb_columns(lhs, rhs, lim, std::make_index_sequence<9>());
+        reduce_secp256k1_limbs(lim, pro);
+    }
+
+    void secp256k1::square_limbs
+        (const uint64_t*const val, uint64_t*const pro)
+    {
+        uint64_t lim[10];
+        square_limb_columns(val, lim, std::make_index_sequence<9>());
+        reduce_secp256k1_limbs(lim, pro);
+    }
+}
@@ -6,12 +6,36 @@ namespace ecc {
     TEST(binteger, big_int_const) {
         {
             CHECK_EQUAL(20, big_int<20>::LOGICAL_SIZE);
-            CHECK_EQUAL(4, big_int<20>::SIZE_OF_FIELD);
-            CHECK_EQUAL(32, big_int<20>::LENGTH_OF_BITS_ON_FIELD);
-            CHECK_EQUAL(0xffffffffull, big_int<20>::FIELD_MASK);
-            CHECK_EQUAL(2, big_int<1>::NUMBER_OF_FIELDS);
-            CHECK_EQUAL(11, big_int<20>::NUMBER_OF_FIELDS);
-            CHECK_EQUAL(10, (big_int<20, true>::NUMBER_OF_FIELDS));
+            CHECK_EQUAL(8, big_int<20>::SIZE_OF_FIELD);
+            CHECK_EQUAL(64, big_int<20>::LENGTH_OF_BITS_ON_FIELD);
+            CHECK_EQUAL(0xffffffffffffffffull, big_int<20>::FIELD_MASK);
+            CHECK_EQUAL(1, big_int<1>::NUMBER_OF_FIELDS);
+            CHECK_EQUAL(6, big_int<20>::NUMBER_OF_FIELDS);
+            CHECK_EQUAL(5, (big_int<20, true>::NUMBER_OF_FIELDS));
+            CHECK_EQUAL(3, (big_int<20, false, false>::NUMBER_OF_FIELDS));
+            CHECK_EQUAL(3, (big_int<20, true, false>::NUMBER_OF_FIELDS));
+            CHECK_EQUAL(5, (big_int<32, false, false>::NUMBER_OF_FIELDS));
+        }
+    }
+
+    TEST(binteger, big_int_layout) {
+        {
+            CHECK(is_trivially_copyable<big_int<20>>::value);
+            CHECK(is_standard_layout<big_int<20>>::value);
+            CHECK(is_nothrow_move_constructible<big_int<20>>::value);
+            CHECK(is_nothrow_move_assignable<big_int<20>>::value);
+            constexpr size_t A = ECCRYPTO_BIG_INT_ALIGNMENT;
+            CHECK_EQUAL(A, alignof(big_int<20>));
+            CHECK_EQUAL((48 + A - 1) / A * A, sizeof(big_int<20>));
+            CHECK_EQUAL((40 + A - 1) / A * A, (sizeof(big_int<32, false, false, true>)));
+        }
+        {
+            const auto a = big_int<20>("1461501637330902918203684832716283019653785059327");
+            vector<big_int<20>> nums(3, a);
+            big_int<20> nums2[3];
+            memcpy(nums2, nums.data(), sizeof(nums2));
+            for (const auto& num : nums2) CHECK_EQUAL(a, num);
+            CHECK_EQUAL(0xffffffff7fffffffull, nums2[0][0]);
         }
     }
 
@@ -68,6 +92,132 @@ namespace ecc {
         }
     }
 
+    TEST(binteger, big_int_radix) {
+        {
+            for (const auto& str : {
+                string("9999999999999999999"),
+                string("10000000000000000000"),
+                string("100000000000000000000000000000000000000"),
+                string(
+                    "2135987035920910082395021706169552114602704522356652769947041607"
+                    "822219725780640550022962086936575"
+                ),
+                string("-1461501637330902918203684832716283019653785059327")
+            }) CHECK_EQUAL(str, describe(big_int<20>(str)));
+        }
+        {
+            CHECK_EQUAL(
+                "7777777777777777777777777777777777777777777777777777777777777777"
+                "7777777777777777777777777777777777777777777777777777777777777776",
+                describe(oct, big_int<20>(-2))
+            );
+            CHECK_EQUAL(
+                "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF"
+                "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFF01",
+                describe(hex, uppercase, big_int<20>(-255))
+            );
+            CHECK_EQUAL(
+                "0x00ff",
+                describe(hex, showbase, internal, setfill('0'), setw(6), big_int<20>(255))
+            );
+            CHECK_EQUAL("-00042", describe(internal, setfill('0'), setw(6), big_int<20>(-42)));
+            CHECK_EQUAL("0", describe(oct, big_int<20>(0)));
+        }
+        {
+            const auto a = big_int<20>("123456789abcdef0123456789abcdef", ios::hex);
+            CHECK_EQUAL(a, big_int<20>(describe(a)));
+            CHECK_EQUAL(a, big_int<20>(describe(oct, a), ios::oct));
+        }
+    }
+
+    TEST(binteger, big_int_bytes) {
+        {
+            uint8_t byts[21];
+            for (size_t i = 0; i < 21; ++i) byts[i] = uint8_t(i + 1);
+            const auto a = big_int<20>::from_bytes(byts, 21);
+            CHECK_EQUAL("102030405060708090a0b0c0d0e0f101112131415", describe(hex, a));
+            const auto b = big_int<20>::from_bytes(byts, 21, false);
+            CHECK_EQUAL("1514131211100f0e0d0c0b0a090807060504030201", describe(hex, b));
+            const auto c = big_int<20>::from_bytes(byts, 3);
+            CHECK_EQUAL("10203", describe(hex, c));
+            uint8_t byts2[21];
+            a.to_bytes(byts2, 21);
+            CHECK(std::equal(byts, byts + 21, byts2));
+            b.to_bytes(byts2, 21, false);
+            CHECK(std::equal(byts, byts + 21, byts2));
+        }
+        {
+            uint8_t byts[56];
+            for (size_t i = 0; i < 56; ++i) byts[i] = 0xff;
+            const auto a = big_int<20>::from_bytes(byts, 56);
+            CHECK_EQUAL(big_int<20>(-1), a);
+            big_int<20>(0x1234).to_bytes(byts, 56, false);
+            CHECK_EQUAL(0x34, byts[0]);
+            CHECK_EQUAL(0x12, byts[1]);
+            for (size_t i = 2; i < 56; ++i) CHECK_EQUAL(0, byts[i]);
+        }
+        {
+            const auto a = big_int<20>("1461501637330902918203684832716283019653785059327");
+            vector<int> byts;
+            number_to_bytes(a, make_putter_from_iterator<int>(back_inserter(byts)));
+            CHECK_EQUAL(20, byts.size());
+            CHECK_EQUAL(0xff, byts[0]);
+            CHECK_EQUAL(0x7f, byts[16]);
+            CHECK_EQUAL(a, bytes_to_number<big_int<20>>(
+                make_getter_from_range<int>(byts.begin(), byts.end())
+            ));
+        }
+    }
+
+    TEST(binteger, big_int_literal) {
+        {
+            constexpr big_int<20> a = 1461501637330902918203684832716283019653785059327_bi;
+            CHECK_EQUAL("1461501637330902918203684832716283019653785059327", describe(a));
+        }
+        {
+            constexpr auto a =
+                big_int<20, false, false>(0xffffffffffffffffffffffffffffffff7fffffff_bi);
+            CHECK_EQUAL("ffffffffffffffffffffffffffffffff7fffffff", describe(hex, a));
+        }
+        {
+            CHECK_EQUAL("-3", describe(big_int<20>(-3_bi)));
+            CHECK_EQUAL("10", describe(big_int<20>(0b1010_bi)));
+            CHECK_EQUAL("15", describe(big_int<20>(017_bi)));
+            CHECK_EQUAL("1000000", describe(big_int<20>(1'000'000_bi)));
+            CHECK_EQUAL("0", describe(big_int<20>(0_bi)));
+        }
+    }
+
+    TEST(binteger, big_uint) {
+        {
+            CHECK_EQUAL(3, big_uint<20>::NUMBER_OF_FIELDS);
+            auto a = big_uint<20>(0) - big_uint<20>(1);
+            CHECK(a > big_uint<20>(1));
+            CHECK_EQUAL("6277101735386680763835789423207666416102355444464034512895", describe(a));
+            CHECK_EQUAL("15", describe(a >> 188));
+            CHECK_EQUAL(
+                "2092367245128893587945263141069222138700785148154678170965",
+                describe(a / big_uint<20>(3))
+            );
+            CHECK_EQUAL("895", describe(a % big_uint<20>(1000)));
+            CHECK_EQUAL(
+                "6277101735386680763835789423207666416102355444464034512895",
+                describe(big_int<20>(a))
+            );
+        }
+        {
+            auto a = big_uint<20>(0) - big_uint<20>(1);
+            auto b = multiply_wide(a, a);
+            CHECK_EQUAL(
+                "3940200619639447921227904010014361380507973927046544666793573920"
+                "0774948409969539032567850922052710929917699921281025",
+                describe(b)
+            );
+            auto p = big_uint<20>(1461501637330902918203684832716283019653785059327_bi);
+            CHECK_EQUAL("85070591809462778380107989442896068609", describe(reduce_wide(b, p)));
+        }
+    }
+
     TEST(binteger, big_int_bitwise_and) {
         {
             auto a = big_int<20>("aaaaaaaaaaaaaaaaaaaa", ios::hex);
@@ -150,6 +300,275 @@ namespace ecc {
             a *= b;
             CHECK_EQUAL("425826231723888350446541592701000", describe(a));
         }
+        {
+            auto a = big_int<20>("-425826231723888350446541592701409065913635568770");
+            auto b = big_int<20>("1174656939883525196875216266011324790309721934540");
+            CHECK_EQUAL(
+                "-500199738278915588131773747628273960427998673207888584402447055"
+                "223286854251516389223997608315800",
+                describe(a * b)
+            );
+            CHECK_EQUAL(describe(a * b), describe(-a * -b));
+        }
+        {
+            auto a = big_int<32>(
+                "ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff", ios::hex
+            );
+            CHECK_EQUAL(
+                "fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffe"
+                "0000000000000000000000000000000000000000000000000000000000000001",
+                describe(hex, a * a)
+            );
+        }
+        {
+            auto a = (big_int<66>(1) << 520) - big_int<66>(12345);
+            auto b = (big_int<66>(1) << 400) + big_int<66>(987654321);
+            CHECK_EQUAL(
+                "1000000000000000000000000000000000000000000000000000000000000000"
+                "000000000000000000000000000003ade68b0ffffffffffffffffffffffffffc"
+                "fc6fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff"
+                "ffffffffffffffffffffffffffff4e930d98097",
+                describe(hex, a * b)
+            );
+        }
+    }
+
+    TEST(binteger, big_int_square) {
+        {
+            auto a = big_int<20>("425826231723888350446541592701409065913635568770");
+            CHECK_EQUAL(
+                "1813279796241666573949302907217712755478575083245777068610438595"
+                "18601329598147752621681399312900",
+                describe(square(a))
+            );
+            CHECK_EQUAL(describe(a * a), describe(square(a)));
+        }
+        {
+            auto a = big_int<20>("-425826231723888350446541592701409065913635568770");
+            CHECK_EQUAL(
+                "1813279796241666573949302907217712755478575083245777068610438595"
+                "18601329598147752621681399312900",
+                describe(square(a))
+            );
+        }
+        {
+            auto a = big_int<20>("ffffffffffffffffffffffffffffffffffffffff", ios::hex);
+            CHECK_EQUAL(
+                "fffffffffffffffffffffffffffffffffffffffe0000000000000000000000000000000000000001",
+                describe(hex, square(a))
+            );
+        }
+        {
+            CHECK_EQUAL("0", describe(square(big_int<20>(0))));
+        }
+    }
+
+    TEST(binteger, big_int_wide) {
+        {
+            auto a = big_int<20, false, false>("425826231723888350446541592701409065913635568770");
+            auto b = multiply_wide(a, a);
+            CHECK_EQUAL(
+                "1813279796241666573949302907217712755478575083245777068610438595"
+                "18601329598147752621681399312900",
+                describe(b)
+            );
+            auto p = big_int<20, false, false>("1461501637330902918203684832716283019653785059327");
+            CHECK_EQUAL(
+                "586567948809518753950302393734745994761799025067",
+                describe(reduce_wide(b, p))
+            );
+            CHECK_EQUAL(
+                "874933688521384164253382438981537024891986034260",
+                describe(reduce_wide(-b, p))
+            );
+        }
+        {
+            auto a = big_int<20, false, false>(-3);
+            auto b = big_int<20>(a);
+            CHECK_EQUAL("-3", describe(b));
+            auto c = big_int<20, false, false>(b);
+            CHECK_EQUAL("-3", describe(c));
+            CHECK_EQUAL("9", describe(multiply_wide(a, a)));
+            CHECK_EQUAL("-6", describe(multiply_wide(a, big_int<20, false, false>(2))));
+        }
+    }
+
+    TEST(binteger, big_int_invert_modulo) {
+        {
+            auto p = big_int<20, false, false>("1461501637330902918203684832716283019653785059327");
+            auto a = big_int<20, false, false>("425826231723888350446541592701409065913635568770");
+            CHECK_EQUAL(
+                "863948770216944208481035953235594248782129974934",
+                describe(invert_modulo(a, p))
+            );
+            CHECK_EQUAL(
+                "730750818665451459101842416358141509826892529664",
+                describe(invert_modulo(big_int<20, false, false>(2), p))
+            );
+            CHECK_EQUAL(
+                "1461501637330902918203684832716283019653785059326",
+                describe(invert_modulo(p - big_int<20, false, false>(1), p))
+            );
+            CHECK_EQUAL("1", describe(invert_modulo(big_int<20, false, false>(1), p)));
+            CHECK_EQUAL("0", describe(invert_modulo(big_int<20, false, false>(0), p)));
+        }
+        {
+            auto p = (big_int<66, false, false>(1) << 521) - big_int<66, false, false>(1);
+            CHECK_EQUAL(
+                "4576531773420406476654600532720928811512956866762203606262975639"
+                "4570287889317707014150397604409697033181975409276539053580813253"
+                "33144429208382685527410038101",
+                describe(invert_modulo(big_int<66, false, false>(3), p))
+            );
+        }
+        {
+            CHECK_EQUAL("0", describe(invert_modulo(big_int<20>(6), big_int<20>(9))));
+            CHECK_EQUAL(4, invert_modulo(2, 7));
+        }
+    }
+
+    TEST(binteger, big_int_add_modulo) {
+        {
+            using bi = big_int<20, false, false>;
+            auto p = bi("1461501637330902918203684832716283019653785059327");
+            auto a = bi("425826231723888350446541592701409065913635568770");
+            CHECK_EQUAL(
+                "851652463447776700893083185402818131827271137540",
+                describe(add_modulo(a, a, p))
+            );
+            CHECK_EQUAL(
+                "1461501637330902918203684832716283019653785059325",
+                describe(add_modulo(p - bi(1), p - bi(1), p))
+            );
+            CHECK_EQUAL("0", describe(add_modulo(p - bi(1), bi(1), p)));
+            CHECK_EQUAL(
+                "1035675405607014567757143240014873953740149491411",
+                describe(subtract_modulo(bi(854), a, p))
+            );
+            CHECK_EQUAL(
+                "1461501637330902918203684832716283019653785059326",
+                describe(subtract_modulo(bi(0), bi(1), p))
+            );
+            CHECK_EQUAL("0", describe(subtract_modulo(a, a, p)));
+            CHECK_EQUAL(
+                "730750818665451459101842416358141509826892529664",
+                describe(halve_modulo(bi(1), p))
+            );
+            CHECK_EQUAL(
+                "1461501637330902918203684832716283019653785059326",
+                describe(halve_modulo(p - bi(2), p))
+            );
+            CHECK_EQUAL("0", describe(halve_modulo(bi(0), p)));
+        }
+        {
+            using bi = big_int<32, false, false>;
+            auto p = bi(
+                "115792089237316195423570985008687907853269984665640564039457584007908834671663"
+            );
+            CHECK_EQUAL(
+                "115792089237316195423570985008687907853269984665640564039457584007908834671661",
+                describe(add_modulo(p - bi(1), p - bi(1), p))
+            );
+            CHECK_EQUAL(
+                "115792089237316195423570985008687907853269984665640564039457584007908834671662",
+                describe(halve_modulo(p - bi(2), p))
+            );
+        }
+        {
+            CHECK_EQUAL(1, add_modulo(5, 3, 7));
+            CHECK_EQUAL(5, subtract_modulo(1, 3, 7));
+            CHECK_EQUAL(5, halve_modulo(3, 7));
+        }
+    }
+
+    TEST(binteger, multiply_fields_karatsuba) {
+        {
+            uint64_t a[17], b[17], c[34], d[34];
+            for (size_t i = 0; i < 17; ++i) {
+                a[i] = i % 3 ? ~uint64_t(0) : 0x9e3779b97f4a7c15ull * (i + 1);
+                b[i] = i % 4 ? 0x0123456789abcdefull ^ (i << 7) : ~uint64_t(0);
+            }
+            multiply_fields<17>(a, b, c);
+            multiply_fields_karatsuba<17, 34, 2>(a, b, d);
+            for (size_t i = 0; i < 34; ++i) CHECK_EQUAL(c[i], d[i]);
+            multiply_fields_karatsuba<17, 17, 3>(a, a, d);
+            multiply_fields<17, 17>(a, a, c);
+            for (size_t i = 0; i < 17; ++i) CHECK_EQUAL(c[i], d[i]);
+        }
+        {
+            uint64_t a[9], b[9], c[18], d[18];
+            for (size_t i = 0; i < 9; ++i) a[i] = b[i] = ~uint64_t(0);
+            multiply_fields<9>(a, b, c);
+            multiply_fields_karatsuba<9, 18, 2>(a, b, d);
+            for (size_t i = 0; i < 18; ++i) CHECK_EQUAL(c[i], d[i]);
+        }
+    }
+
+    TEST(binteger, select_kernels) {
+        const uint64_t o[] = {
+            0xffffffffffffffffull,
+            0x00000000ffffffffull,
+            0x0000000000000000ull,
+            0xffffffff00000001ull
+        };
+        uint64_t a[4], b[4];
+        for (size_t i = 0; i < 4; ++i) {
+            a[i] = o[i] - 0x9e3779b97f4a7c15ull * (i + 1) % (o[i] | 1);
+            b[i] = i % 2 ? o[i] - 1 : 0x0123456789abcdefull ^ (i << 7);
+        }
+        const field_kernels gen = select_kernels(true);
+        CHECK_EQUAL(std::string("generic"), kernels().name);
+        const field_kernels& ker = select_kernels(false);
+        if (!supports_bmi2_adx())
+            CHECK_EQUAL(std::string("generic"), ker.name);
+        {
+            uint64_t c[8], d[8];
+            gen.multiply(a, b, 4, c);
+            ker.multiply(a, b, 4, d);
+            for (size_t i = 0; i < 8; ++i) CHECK_EQUAL(c[i], d[i]);
+            gen.square(a, 4, c);
+            ker.square(a, 4, d);
+            for (size_t i = 0; i < 8; ++i) CHECK_EQUAL(c[i], d[i]);
+        }
+        {
+            uint64_t c[9], d[9];
+            gen.square(b, 4, c);
+            ker.square(b, 4, d);
+            c[8] = d[8] = 0;
+            gen.montgomery_reduce(c, o, 4, 1);
+            ker.montgomery_reduce(d, o, 4, 1);
+            for (size_t i = 4; i < 9; ++i) CHECK_EQUAL(c[i], d[i]);
+        }
+        {
+            uint64_t c[6], d[6];
+            gen.montgomery_multiply(a, b, o, 4, 1, c);
+            ker.montgomery_multiply(a, b, o, 4, 1, d);
+            for (size_t i = 0; i < 6; ++i) CHECK_EQUAL(c[i], d[i]);
+        }
+    }
+
+    TEST(binteger, big_int_batch) {
+        for (int gen = 1; gen >= 0; --gen) {
+            select_kernels(gen);
+            big_int_batch<big_uint<20>, 5> a, b;
+            big_uint<20> c[5], d[5];
+            for (size_t i = 0; i < 5; ++i) {
+                c[i] = big_uint<20>("425826231723888350446541592701409065913635568770") *
+                    big_uint<20>(int(i + 1));
+                d[i] = i % 2 ? ~big_uint<20>(0) : big_uint<20>(int(i));
+                a.set(i, c[i]);
+                b.set(i, d[i]);
+            }
+            const auto e = a + b, f = a - b, g = a * b;
+            for (size_t i = 0; i < 5; ++i) {
+                CHECK(a.get(i) == c[i]);
+                CHECK(e.get(i) == c[i] + d[i]);
+                CHECK(f.get(i) == c[i] - d[i]);
+                CHECK(g.get(i) == c[i] * d[i]);
+            }
+            const auto h = big_int_batch<big_uint<20>, 5>(big_uint<20>(7));
+            CHECK_EQUAL("7", describe(h.get(4)));
+        }
     }
 
     TEST(binteger, big_int_add) {
@@ -165,6 +584,16 @@ namespace ecc {
             a += b;
             CHECK_EQUAL("629346345886792458320533050658755957941618210740", describe(a));
         }
+        {
+            auto a = big_int<20>("ffffffffffffffffffffffffffffffff", ios::hex);
+            auto b = a + big_int<20>(1);
+            CHECK_EQUAL("100000000000000000000000000000000", describe(hex, b));
+            CHECK_EQUAL("ffffffffffffffffffffffffffffffff", describe(hex, b - big_int<20>(1)));
+            CHECK_EQUAL(
+                "fffffffffffffffffffffffffffffffe00000000000000000000000000000001",
+                describe(hex, a * a)
+            );
+        }
     }
 
     TEST(binteger, big_int_negate) {
@@ -203,6 +632,36 @@ namespace ecc {
             a /= b;
             CHECK_EQUAL("209230538944687898", describe(a));
         }
+        {
+            auto a = big_int<20>("ffffffffffffffffffffffffffffffffffffffffffffffff", ios::hex);
+            auto b = big_int<20>("ffffffffffffffff0000000000000001", ios::hex);
+            CHECK_EQUAL("10000000000000000", describe(hex, a / b));
+            CHECK_EQUAL("fffffffffffffffeffffffffffffffff", describe(hex, a % b));
+        }
+        {
+            auto a = big_int<20>("800000000000000000000000000000000000000000000000", ios::hex);
+            auto b = big_int<20>("800000000000000000000001", ios::hex);
+            CHECK_EQUAL("fffffffffffffffffffffffe", describe(hex, a / b));
+            CHECK_EQUAL("2", describe(hex, a % b));
+        }
+        {
+            auto a = big_int<20>("123456789abcdef0123456789abcdef0123456789abcdef0", ios::hex);
+            auto b = big_int<20>("fedcba987654321", ios::hex);
+            CHECK_EQUAL("1249249249249237feb1a1f58d0fac589", describe(hex, a / b));
+            CHECK_EQUAL("25e51c7daa98d47", describe(hex, a % b));
+        }
+        {
+            auto a = big_int<20>("1fffffffffffffffffffffffffffffffd", ios::hex);
+            auto b = big_int<20>("ffffffffffffffffffffffffffffffff", ios::hex);
+            CHECK_EQUAL("1", describe(hex, a / b));
+            CHECK_EQUAL("fffffffffffffffffffffffffffffffe", describe(hex, a % b));
+        }
+        {
+            auto a = big_int<20>("-425826231723888350446541592701409065913635568770");
+            auto b = big_int<20>("2035201141629041078739914579573");
+            CHECK_EQUAL("-209230538944687898", describe(a / b));
+            CHECK_EQUAL("-624949790712844072763264461216", describe(a % b));
+        }
     }
 
     TEST(binteger, big_int_less) {
@@ -291,16 +750,22 @@ namespace ecc {
 
     TEST(binteger, big_int_at) {
         {
-            auto a = big_int<20>("123456789abcdef0", ios::hex);
-            CHECK_EQUAL(0x9abcdef0ull, a[0]);
-            CHECK_EQUAL(0x12345678ull, a[1]);
-            a[0] = 0x0fedcba9ull;
-            a[1] = 0x87654321ull;
-            CHECK_EQUAL(0x0fedcba9ull, a[0]);
-            CHECK_EQUAL(0x87654321ull, a[1]);
-            const auto b = big_int<20>("123456789abcdef0", ios::hex);
-            CHECK_EQUAL(0x9abcdef0ull, b[0]);
-            CHECK_EQUAL(0x12345678ull, b[1]);
+            auto a = big_int<20>("0fedcba987654321123456789abcdef0", ios::hex);
+            CHECK_EQUAL(0x123456789abcdef0ull, a[0]);
+            CHECK_EQUAL(0x0fedcba987654321ull, a[1]);
+            a[0] = 0x0fedcba987654321ull;
+            a[1] = 0x123456789abcdef0ull;
+            CHECK_EQUAL(0x0fedcba987654321ull, a[0]);
+            CHECK_EQUAL(0x123456789abcdef0ull, a[1]);
+            CHECK_EQUAL("123456789abcdef00fedcba987654321", describe(hex, a));
+            const auto b = big_int<20>("0fedcba987654321123456789abcdef0", ios::hex);
+            CHECK_EQUAL(0x123456789abcdef0ull, b[0]);
+            CHECK_EQUAL(0x0fedcba987654321ull, b[1]);
+        }
+        {
+            auto a = big_int<20>(-3);
+            CHECK_EQUAL(0xfffffffffffffffdull, a[0]);
+            CHECK_EQUAL(0xffffffffffffffffull, a[1]);
         }
     }
 
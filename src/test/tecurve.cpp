@@ -9,6 +9,152 @@ namespace ecc {
     const auto G = make_shared<PrimeField<int>>(11);
     const auto ge = make_factory<element<int>>(G.get());
 
+    template <size_t N, typename V> vector<V> sample_numbers(const V& ord) {
+        vector<V> nums({V(0), V(1), ord - V(1), ord - V(2)});
+        for (size_t i = 0; i < 4; ++i) {
+            V num(0);
+            for (size_t j = 0; j < N; ++j)
+                num[j] = 0x9e3779b97f4a7c15ull * (i * N + j + 1);
+            nums.push_back(num);
+        }
+        return nums;
+    }
+
+    template <class K> void check_special_prime_field() {
+        using bi = big_int<66>;
+        const auto S = make_shared<SpecialPrimeField<bi, K>>();
+        const auto se = make_factory<element<bi>>(S.get());
+        const auto P = make_shared<PrimeField<bi>>(S->order());
+        const auto pe = make_factory<element<bi>>(P.get());
+        const auto nums = sample_numbers<K::NUMBER_OF_FIELDS>(S->order());
+        for (const auto& a : nums) {
+            CHECK_EQUAL(describe(pe(a)), describe(se(a)));
+            for (const auto& b : nums) {
+                CHECK_EQUAL(describe(pe(a) * pe(b)), describe(se(a) * se(b)));
+                CHECK_EQUAL(describe(pe(a) + pe(b)), describe(se(a) + se(b)));
+                CHECK_EQUAL(describe(pe(a) - pe(b)), describe(se(a) - se(b)));
+            }
+            CHECK_EQUAL(describe(pe(a) * pe(a)), describe(square(se(a))));
+            CHECK_EQUAL(describe(halve(pe(a))), describe(halve(se(a))));
+            CHECK(halve(se(a)) + halve(se(a)) == se(a));
+        }
+    }
+
+    template <class K> void check_addition_chains() {
+        using bi = big_int<66>;
+        const auto S = make_shared<SpecialPrimeField<bi, K>>();
+        const auto se = make_factory<element<bi>>(S.get());
+        const auto one = se(bi(1));
+        for (const auto& num : sample_numbers<K::NUMBER_OF_FIELDS>(S->order())) {
+            const auto a = se(num);
+            if (!a) continue;
+            CHECK(pow(a, K::INVERSION_CHAIN) == one / a);
+            CHECK(pow(a, K::INVERSION_CHAIN) == pow(a, S->order() - bi(2)));
+            CHECK(square(pow(square(a), K::SQUARE_ROOT_CHAIN)) == square(a));
+        }
+    }
+
+    template <class K> void check_fp() {
+        using bi = big_int<66>;
+        using fe = fp<bi, K>;
+        const auto S = make_shared<SpecialPrimeField<bi, K>>();
+        const auto se = make_factory<element<bi>>(S.get());
+        auto nums = sample_numbers<K::NUMBER_OF_FIELDS>(S->order());
+        nums.push_back(-bi(5));
+        nums.push_back(S->order() * bi(3) + bi(7));
+        for (const auto& a : nums) {
+            CHECK_EQUAL(describe(se(a)), describe(fe(a)));
+            CHECK_EQUAL(describe(-se(a)), describe(-fe(a)));
+            CHECK_EQUAL(describe(square(se(a))), describe(square(fe(a))));
+            CHECK_EQUAL(bool(se(a)), bool(fe(a)));
+            for (const auto& b : nums) {
+                CHECK_EQUAL(describe(se(a) * se(b)), describe(fe(a) * fe(b)));
+                CHECK_EQUAL(describe(se(a) + se(b)), describe(fe(a) + fe(b)));
+                CHECK_EQUAL(describe(se(a) - se(b)), describe(fe(a) - fe(b)));
+                CHECK_EQUAL(se(a) == se(b), fe(a) == fe(b));
+                if (se(b)) {
+                    CHECK_EQUAL(describe(se(a) / se(b)), describe(fe(a) / fe(b)));
+                }
+            }
+        }
+    }
+
+    template <class K> void check_unsaturated_field() {
+        using bi = big_int<32>;
+        const auto U = make_shared<UnsaturatedField<bi, K>>();
+        const auto ue = make_factory<element<bi>>(U.get());
+        const auto P = make_shared<PrimeField<bi>>(U->order());
+        const auto pe = make_factory<element<bi>>(P.get());
+        const auto nums = sample_numbers<K::NUMBER_OF_FIELDS>(U->order());
+        for (const auto& a : nums) {
+            CHECK_EQUAL(describe(pe(a)), describe(ue(a)));
+            CHECK_EQUAL(describe(-pe(a)), describe(-ue(a)));
+            CHECK_EQUAL(bool(pe(a)), bool(ue(a)));
+            for (const auto& b : nums) {
+                CHECK_EQUAL(describe(pe(a) * pe(b)), describe(ue(a) * ue(b)));
+                CHECK_EQUAL(describe(pe(a) + pe(b)), describe(ue(a) + ue(b)));
+                CHECK_EQUAL(describe(pe(a) - pe(b)), describe(ue(a) - ue(b)));
+                CHECK(ue(a) + ue(b) - ue(b) == ue(a));
+                if (b) {
+                    CHECK_EQUAL(describe(pe(a) / pe(b)), describe(ue(a) / ue(b)));
+                }
+            }
+            CHECK_EQUAL(describe(pe(a) * pe(a)), describe(square(ue(a))));
+            CHECK_EQUAL(describe(halve(pe(a))), describe(halve(ue(a))));
+            CHECK(halve(ue(a)) + halve(ue(a)) == ue(a));
+        }
+        {
+            auto p = pe(nums[2]), q = pe(nums[4]);
+            auto u = ue(nums[2]), v = ue(nums[4]);
+            for (size_t i = 0; i < 300; ++i) {
+                p += p + q;
+                u += u + v;
+                q -= p;
+                v -= u;
+            }
+            CHECK_EQUAL(describe(p), describe(u));
+            CHECK_EQUAL(describe(q), describe(v));
+            CHECK_EQUAL(describe(p * q), describe(u * v));
+            CHECK(u - u == ue(bi(0)));
+            CHECK(!(u - u));
+        }
+    }
+
+    template <typename V> void check_element_acc(PrimeField<V>*const F) {
+        const auto e = make_factory<element<V>>(F);
+        vector<element<V>> eles;
+        for (const auto& num : sample_numbers<4>(F->order()))
+            eles.push_back(e(num));
+        for (size_t n = 1; n <= 200; n *= 3) {
+            element_acc<V> acc(F);
+            auto sum = e(V(0));
+            for (size_t i = 0; i < n; ++i) {
+                const auto& a = eles[i % eles.size()];
+                const auto& b = eles[(i * 5 + 2) % eles.size()];
+                if (i % 4 == 3) {
+                    acc.multiply_subtract(a, b);
+                    sum -= a * b;
+                } else if (i % 4 == 2) {
+                    acc -= a;
+                    sum -= a;
+                } else if (i % 4 == 1) {
+                    acc += b;
+                    sum += b;
+                } else {
+                    acc.multiply_add(a, b);
+                    sum += a * b;
+                }
+                CHECK(acc.value() == sum);
+            }
+            CHECK_EQUAL(describe(sum), describe(acc.value()));
+        }
+        for (const auto& a : eles) {
+            element_acc<V> acc(F);
+            for (size_t i = 0; i < 100; ++i) acc.multiply_add(eles[2], a);
+            CHECK_EQUAL(describe(e(V(-100)) * a), describe(acc.value()));
+        }
+    }
+
     TEST_GROUP(ecurve) {};
 
     TEST(ecurve, PrimeField) {
@@ -18,6 +164,136 @@ namespace ecc {
         }
     }
 
+    TEST(ecurve, MontgomeryField) {
+        using bi = big_int<20>;
+        const auto p = bi("1461501637330902918203684832716283019653785059327");
+        const auto P = make_shared<PrimeField<bi>>(p);
+        const auto pe = make_factory<element<bi>>(P.get());
+        const auto M = make_shared<MontgomeryField<bi>>(p);
+        const auto me = make_factory<element<bi>>(M.get());
+        {
+            CHECK_EQUAL(describe(p), describe(M->order()));
+            CHECK_EQUAL("12345", describe(me(bi(12345)).value()));
+            CHECK_EQUAL(describe(p - bi(1)), describe(me(bi(-1))));
+        }
+        {
+            const auto x = bi("425826231723888350446541592701409065913635568770");
+            const auto y = bi("203520114162904107873991457957346892027982641970");
+            CHECK_EQUAL(describe(pe(x) * pe(y)), describe(me(x) * me(y)));
+            CHECK_EQUAL(describe(pe(x) + pe(y)), describe(me(x) + me(y)));
+            CHECK_EQUAL(describe(pe(y) - pe(x)), describe(me(y) - me(x)));
+            CHECK_EQUAL(describe(pe(x) / pe(y)), describe(me(x) / me(y)));
+            CHECK(me(x) / me(y) * me(y) == me(x));
+            CHECK_EQUAL(describe(pe(x) * pe(x)), describe(square(me(x))));
+            CHECK_EQUAL(describe(square(pe(x))), describe(square(me(x))));
+            CHECK_EQUAL(describe(halve(pe(x))), describe(halve(me(x))));
+            CHECK_EQUAL(describe(pe(y) + pe(y)), describe(me(y) + me(y)));
+        }
+        {
+            const auto E = make_shared<EllipticCurve<bi>>(
+                M.get(),
+                me(bi(-3)),
+                me(bi("163235791306168110546604919403271579530548345413"))
+            );
+            const auto mp = make_factory<rational_point<bi>>(E.get());
+            const auto Q = mp(
+                me(bi("425826231723888350446541592701409065913635568770")),
+                me(bi("203520114162904107873991457957346892027982641970"))
+            );
+            const auto L = make_shared<PrimeField<bi>>
+                (bi("1461501637330902918203687197606826779884643492439"));
+            const auto le = make_factory<element<bi>>(L.get());
+            const auto R =
+                (le(bi("100000000000000000000000000000000000000000000000")) * Q).project();
+            CHECK_EQUAL("1174656939883525196875216266011324790309721934540", describe(R.x()));
+            CHECK_EQUAL("1342400482006863372094556267586242549171571342627", describe(R.y()));
+        }
+    }
+
+    TEST(ecurve, SpecialPrimeField) {
+        {
+            check_special_prime_field<secp160r1>();
+            check_special_prime_field<secp192r1>();
+            check_special_prime_field<secp224r1>();
+            check_special_prime_field<secp256r1>();
+            check_special_prime_field<secp384r1>();
+            check_special_prime_field<secp521r1>();
+            check_special_prime_field<secp256k1>();
+        }
+        {
+            auto S = make_shared<SpecialPrimeField<big_int<20>, secp160r1>>();
+            CHECK_EQUAL("1461501637330902918203684832716283019653785059327", describe(S->order()));
+        }
+    }
+
+    TEST(ecurve, UnsaturatedField) {
+        {
+            check_unsaturated_field<secp256r1>();
+            check_unsaturated_field<secp256k1>();
+        }
+        {
+            using bi = big_int<32>;
+            const auto U = make_shared<UnsaturatedField<bi, secp256k1>>();
+            const auto ue = make_factory<element<bi>>(U.get());
+            const auto E = make_shared<EllipticCurve<bi>>
+                (U.get(), ue(bi(0)), ue(bi(7)));
+            const auto up = make_factory<rational_point<bi>>(E.get());
+            const auto Q = up(
+                ue(bi(
+                    "55066263022277343669578718895168534326250603453777594175500187360389116729240"
+                )),
+                ue(bi(
+                    "32670510020758816978083085130507043184471273380659243275938904335757337482424"
+                ))
+            );
+            const auto L = make_shared<PrimeField<bi>>(bi(
+                "115792089237316195423570985008687907852837564279074904382605163141518161494337"
+            ));
+            const auto le = make_factory<element<bi>>(L.get());
+            const auto R = (le(bi(2)) * Q).project();
+            CHECK_EQUAL(
+                "89565891926547004231252920425935692360644145829622209833684329913297188986597",
+                describe(R.x())
+            );
+            CHECK_EQUAL(
+                "12158399299693830322967808612713398636155367887041628176798871954788371653930",
+                describe(R.y())
+            );
+        }
+    }
+
+    TEST(ecurve, fp) {
+        {
+            check_fp<secp160r1>();
+            check_fp<secp192r1>();
+            check_fp<secp224r1>();
+            check_fp<secp256r1>();
+            check_fp<secp384r1>();
+            check_fp<secp521r1>();
+            check_fp<secp256k1>();
+        }
+        {
+            using bi = big_int<32>;
+            using fe = fp<bi, secp256k1>;
+            CHECK_EQUAL(32, sizeof(fe));
+            const auto x = fe(bi(
+                "55066263022277343669578718895168534326250603453777594175500187360389116729240"
+            ));
+            const auto y = fe(bi(
+                "32670510020758816978083085130507043184471273380659243275938904335757337482424"
+            ));
+            CHECK(square(y) == square(x) * x + fe(bi(7)));
+            CHECK(pow(x, secp256k1::INVERSION_CHAIN) == fe(bi(1)) / x);
+            CHECK(pow(x, bi(3)) == square(x) * x);
+            auto z = x;
+            z *= y;
+            z += x;
+            z -= y;
+            z /= x;
+            CHECK(z == y + fe(bi(1)) - y / x);
+        }
+    }
+
     TEST(ecurve, element_new) {
         {
             element<int> e;
@@ -67,6 +343,227 @@ namespace ecc {
         }
     }
 
+    TEST(ecurve, element_square) {
+        {
+            auto a = fe(3);
+            auto b = square(a);
+            CHECK_EQUAL(2, b.value());
+        }
+    }
+
+    TEST(ecurve, element_halve) {
+        {
+            CHECK_EQUAL(5, halve(fe(3)).value());
+            CHECK_EQUAL(2, halve(fe(4)).value());
+            CHECK_EQUAL(0, halve(fe(0)).value());
+            CHECK_EQUAL(3, halve(fe(6)).value());
+        }
+        {
+            for (int i = 0; i < 11; ++i) CHECK(halve(ge(i)) * ge(2) == ge(i));
+        }
+    }
+
+    TEST(ecurve, element_multiply_small) {
+        {
+            CHECK_EQUAL(6, multiply_small(fe(3), 2).value());
+            CHECK_EQUAL(2, multiply_small(fe(3), 3).value());
+            CHECK_EQUAL(5, multiply_small(fe(3), 4).value());
+            CHECK_EQUAL(3, multiply_small(fe(3), 8).value());
+            CHECK_EQUAL(3, multiply_small(fe(3), 1).value());
+            CHECK_EQUAL(0, multiply_small(fe(3), 0).value());
+        }
+        {
+            using bi = big_int<32>;
+            const auto U = make_shared<UnsaturatedField<bi, secp256k1>>();
+            const auto ue = make_factory<element<bi>>(U.get());
+            const auto a = ue(U->order() - bi(1));
+            for (unsigned i = 0; i < 20; ++i)
+                CHECK(multiply_small(a, i) == ue(bi(int(i))) * a);
+        }
+    }
+
+    TEST(ecurve, element_square_root) {
+        {
+            for (int p : {7, 11, 13, 17, 29, 41, 73, 97}) {
+                const auto P = make_shared<PrimeField<int>>(p);
+                const auto pe = make_factory<element<int>>(P.get());
+                for (int a = 0; a < p; ++a) {
+                    bool squ = false;
+                    for (int b = 0; b < p; ++b) squ = squ || b * b % p == a;
+                    CHECK_EQUAL(squ, is_square(pe(a)));
+                    CHECK_EQUAL(squ, square(square_root(pe(a))) == pe(a));
+                }
+            }
+        }
+        {
+            using bi = big_int<32>;
+            const auto S = make_shared<SpecialPrimeField<bi, secp224r1>>();
+            const auto se = make_factory<element<bi>>(S.get());
+            const auto U = make_shared<UnsaturatedField<bi, secp256k1>>();
+            const auto ue = make_factory<element<bi>>(U.get());
+            const auto T = make_shared<SpecialPrimeField<bi, secp256r1>>();
+            const auto te = make_factory<element<bi>>(T.get());
+            const auto P = make_shared<PrimeField<bi>>(T->order());
+            const auto pe = make_factory<element<bi>>(P.get());
+            for (const auto& num : sample_numbers<4>(U->order())) {
+                if (!num) continue;
+                CHECK_EQUAL(describe(square_root(pe(num))), describe(square_root(te(num))));
+                CHECK_EQUAL(is_square(pe(num)), is_square(te(num)));
+                const auto a = square(se(num)), b = square(ue(num));
+                CHECK(is_square(a));
+                CHECK(square(square_root(a)) == a);
+                CHECK(is_square(b));
+                CHECK(square(square_root(b)) == b);
+                CHECK(!is_square(-b));
+                CHECK(square(square_root(-b)) != -b);
+            }
+            CHECK(!is_square(se(bi(11))));
+            CHECK(square(square_root(se(bi(11)))) != se(bi(11)));
+            CHECK(!square_root(se(bi(0))));
+        }
+    }
+
+    TEST(ecurve, element_pow) {
+        {
+            CHECK_EQUAL(4, pow(fe(2), 5).value());
+            CHECK_EQUAL(1, pow(fe(3), 6).value());
+            CHECK_EQUAL(5, pow(fe(3), 5).value());
+            CHECK_EQUAL(1, pow(fe(3), 0).value());
+            CHECK_EQUAL(0, pow(fe(0), 4).value());
+        }
+        {
+            using bi = big_int<20>;
+            const auto p = bi("1461501637330902918203684832716283019653785059327");
+            const auto M = make_shared<MontgomeryField<bi>>(p);
+            const auto me = make_factory<element<bi>>(M.get());
+            const auto a = me(bi("425826231723888350446541592701409065913635568770"));
+            CHECK(pow(a, p - bi(1)) == me(bi(1)));
+            CHECK(pow(a, p - bi(2)) == me(bi(1)) / a);
+            CHECK(pow(a, bi(1000)) == pow(pow(a, bi(10)), bi(100)));
+        }
+        {
+            check_addition_chains<secp256r1>();
+            check_addition_chains<secp521r1>();
+            check_addition_chains<secp256k1>();
+        }
+    }
+
+    TEST(ecurve, element_invert_batch) {
+        {
+            vector<element<int>> a({fe(3), fe(0), fe(6), fe(1), fe(5)});
+            invert_batch(a.begin(), a.end());
+            CHECK_EQUAL("5 0 6 1 3", describe_with(" ", a[0], a[1], a[2], a[3], a[4]));
+        }
+        {
+            vector<element<int>> a({fe(0)});
+            invert_batch(a.begin(), a.end());
+            CHECK_EQUAL(0, a[0].value());
+            invert_batch(a.begin(), a.begin());
+        }
+        {
+            using bi = big_int<20>;
+            const auto p = bi("1461501637330902918203684832716283019653785059327");
+            const auto M = make_shared<MontgomeryField<bi>>(p);
+            const auto me = make_factory<element<bi>>(M.get());
+            vector<element<bi>> a, b;
+            for (size_t i = 1; i <= 16; ++i)
+                a.push_back(
+                    me(bi("425826231723888350446541592701409065913635568770") * bi(int(i)))
+                );
+            for (const auto& e : a) b.push_back(me(bi(1)) / e);
+            invert_batch(a.begin(), a.end());
+            for (size_t i = 0; i < a.size(); ++i) CHECK(a[i] == b[i]);
+        }
+    }
+
+    TEST(ecurve, element_batch) {
+        using bi = big_int<20>;
+        const auto p = bi("1461501637330902918203684832716283019653785059327");
+        const auto x = bi("425826231723888350446541592701409065913635568770");
+        const auto P = make_shared<PrimeField<bi>>(p);
+        const auto M = make_shared<MontgomeryField<bi>>(p);
+        for (int gen = 1; gen >= 0; --gen) {
+            select_kernels(gen);
+            for (PrimeField<bi>* F : {P.get(), (PrimeField<bi>*)M.get()}) {
+                const auto e = make_factory<element<bi>>(F);
+                vector<element<bi>> a, b;
+                element_batch<bi, 6> c(F), d(F);
+                for (size_t i = 0; i < 6; ++i) {
+                    a.push_back(e(x * bi(int(i + 1))));
+                    b.push_back(e(p - bi(int(i))));
+                    c.set(i, a[i]);
+                    d.set(i, b[i]);
+                }
+                const auto s = c + d, t = c - d, u = c * d;
+                for (size_t i = 0; i < 6; ++i) {
+                    CHECK(c.get(i) == a[i]);
+                    CHECK(s.get(i) == a[i] + b[i]);
+                    CHECK(t.get(i) == a[i] - b[i]);
+                    CHECK(u.get(i) == a[i] * b[i]);
+                }
+            }
+        }
+        {
+            using bi = big_int<32>;
+            const auto U = make_shared<UnsaturatedField<bi, secp256r1>>();
+            const auto ue = make_factory<element<bi>>(U.get());
+            const auto nums = sample_numbers<4>(U->order());
+            element_batch<bi, 8> c(U.get()), d(U.get());
+            for (size_t i = 0; i < 8; ++i) {
+                c.set(i, ue(nums[i]) + ue(nums[i]));
+                d.set(i, ue(nums[7 - i]));
+            }
+            const auto s = c + d, t = c - d, u = c * d;
+            for (size_t i = 0; i < 8; ++i) {
+                const auto a = ue(nums[i]) + ue(nums[i]), b = ue(nums[7 - i]);
+                CHECK(c.get(i) == a);
+                CHECK_EQUAL(describe(a + b), describe(s.get(i)));
+                CHECK_EQUAL(describe(a - b), describe(t.get(i)));
+                CHECK_EQUAL(describe(a * b), describe(u.get(i)));
+            }
+        }
+    }
+
+    TEST(ecurve, element_acc) {
+        {
+            element_acc<int> acc(F.get());
+            acc.multiply_add(fe(3), fe(5));
+            acc.multiply_subtract(fe(6), fe(6));
+            acc += fe(4);
+            acc -= fe(1);
+            CHECK_EQUAL(3, acc.value().value());
+        }
+        {
+            using bi = big_int<32>;
+            const auto p = bi(
+                "115792089210356248762697446949407573530086143415290314195533631308867097853951"
+            );
+            const auto P = make_shared<PrimeField<bi>>(p);
+            const auto M = make_shared<MontgomeryField<bi>>(p);
+            const auto S = make_shared<SpecialPrimeField<bi, secp256r1>>();
+            const auto U = make_shared<UnsaturatedField<bi, secp256r1>>();
+            check_element_acc<bi>(P.get());
+            check_element_acc<bi>(M.get());
+            check_element_acc<bi>(S.get());
+            check_element_acc<bi>(U.get());
+        }
+        {
+            using bi = big_int<20>;
+            const auto p = bi("1461501637330902918203684832716283019653785059327");
+            const auto M = make_shared<MontgomeryField<bi>>(p);
+            const auto S = make_shared<SpecialPrimeField<bi, secp160r1>>();
+            check_element_acc<bi>(M.get());
+            check_element_acc<bi>(S.get());
+        }
+        {
+            using bi = big_int<66>;
+            const auto S = make_shared<SpecialPrimeField<bi, secp521r1>>();
+            const auto T = make_shared<SpecialPrimeField<bi, secp256k1>>();
+            check_element_acc<bi>(S.get());
+            check_element_acc<bi>(T.get());
+        }
+    }
+
     TEST(ecurve, element_scalar_multiply) {
         {
             auto P = (ge(2) * B).project();
@@ -140,6 +637,15 @@ namespace ecc {
             CHECK_EQUAL(7, C->primeField()->order());
             CHECK_EQUAL(2, C->coefficientA().value());
             CHECK_EQUAL(6, C->coefficientB().value());
+            CHECK_EQUAL(1, C->one().value());
+        }
+        {
+            using bi = big_int<20>;
+            const auto M = make_shared<MontgomeryField<bi>>
+                (bi("1461501637330902918203684832716283019653785059327"));
+            const auto me = make_factory<element<bi>>(M.get());
+            auto C = make_shared<EllipticCurve<bi>>(M.get(), me(bi(-3)), me(bi(7)));
+            CHECK(C->one() == me(bi(1)));
         }
     }
 
@@ -278,4 +784,93 @@ namespace ecc {
             CHECK_EQUAL(1, P.z().value());
         }
     }
+
+    TEST(ecurve, rational_point_decompress) {
+        {
+            rational_point<int> P;
+            CHECK(rational_point<int>::decompress(E.get(), fe(1), B.is_odd(), &P));
+            CHECK(P == B);
+            CHECK(rational_point<int>::decompress(E.get(), fe(1), !B.is_odd(), &P));
+            CHECK(P == -B);
+            for (int x = 0; x < 7; ++x) {
+                for (bool odd : {false, true}) {
+                    if (rational_point<int>::decompress(E.get(), fe(x), odd, &P)) {
+                        CHECK_EQUAL(odd, P.is_odd());
+                        CHECK(square(P.y()) == (square(P.x()) + fe(2)) * P.x() + fe(6));
+                    }
+                }
+            }
+            CHECK(!rational_point<int>::decompress(E.get(), fe(0), false, &P));
+        }
+        {
+            using bi = big_int<20>;
+            const auto M = make_shared<MontgomeryField<bi>>
+                (bi("1461501637330902918203684832716283019653785059327"));
+            const auto me = make_factory<element<bi>>(M.get());
+            const auto C = make_shared<EllipticCurve<bi>>
+                (M.get(), me(bi(-3)), me(bi("163235791306168110546604919403271579530548345413")));
+            const auto mp = make_factory<rational_point<bi>>(C.get());
+            const auto Q = mp(
+                me(bi("425826231723888350446541592701409065913635568770")),
+                me(bi("203520114162904107873991457957346892027982641970"))
+            );
+            auto R = Q;
+            for (size_t i = 0; i < 8; ++i) {
+                R = R + R + Q;
+                rational_point<bi> S;
+                CHECK(rational_point<bi>::decompress(C.get(), R.project().x(), R.is_odd(), &S));
+                CHECK(S == R);
+            }
+        }
+    }
+
+    TEST(ecurve, fixed_base_table) {
+        {
+            for (size_t numOfTee : {1, 2, 4, 5}) {
+                for (size_t numOfTab : {1, 2, 3, 40}) {
+                    const FixedBaseTable<int> T(B, numOfTee, numOfTab);
+                    for (int k = 0; k < 11; ++k)
+                        CHECK(T.multiply(ge(k)) == ge(k) * B);
+                }
+            }
+            CHECK_THROWS(invalid_argument, FixedBaseTable<int>(B, 0, 2));
+            CHECK_THROWS(invalid_argument, FixedBaseTable<int>(B, 17, 2));
+            CHECK_THROWS(invalid_argument, FixedBaseTable<int>(B, 64, 2));
+            CHECK_THROWS(invalid_argument, FixedBaseTable<int>(B, 4, 0));
+        }
+        {
+            using bi = big_int<20>;
+            const bi ord("1461501637330902918203684832716283019653785059327");
+            const auto P = make_shared<PrimeField<bi>>(ord);
+            const auto M = make_shared<MontgomeryField<bi>>(ord);
+            const auto G = make_shared<PrimeField<bi>>
+                (bi("1461501637330902918203687197606826779884643492439"));
+            const auto ge = make_factory<element<bi>>(G.get());
+            const vector<PrimeField<bi>*> fies{P.get(), M.get()};
+            for (PrimeField<bi>* F : fies) {
+                const auto fe = make_factory<element<bi>>(F);
+                const auto C = make_shared<EllipticCurve<bi>>
+                    (F, fe(bi(-3)), fe(bi("163235791306168110546604919403271579530548345413")));
+                const auto cp = make_factory<rational_point<bi>>(C.get());
+                const auto Q = cp(
+                    fe(bi("425826231723888350446541592701409065913635568770")),
+                    fe(bi("203520114162904107873991457957346892027982641970"))
+                );
+                const auto T = make_shared<FixedBaseTable<bi>>(Q);
+                const FixedBaseTable<bi> U(Q, 5, 3);
+                vector<bi> scas({bi(0), bi(1), bi(2), G->order() - bi(1)});
+                for (size_t i = 0; i < 4; ++i) {
+                    bi sca(0);
+                    for (size_t j = 0; j < 3; ++j)
+                        sca[j] = 0x9e3779b97f4a7c15ull * (i * 3 + j + 1);
+                    scas.push_back(sca);
+                }
+                for (const auto& sca : scas) {
+                    CHECK(T->multiply(ge(sca)) == ge(sca) * Q);
+                    CHECK(U.multiply(ge(sca)) == ge(sca) * Q);
+                }
+                CHECK(T->multiply(ge(G->order() - bi(1))) == -Q);
+            }
+        }
+    }
 }
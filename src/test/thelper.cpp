@@ -73,6 +73,24 @@ namespace ecc {
             CHECK_EQUAL(0x2010, nums.at(0));
             CHECK_EQUAL(0x4030, nums.at(1));
         }
+        {
+            const uint8_t byts[] = {0x10, 0x20, 0x30, 0x40, 0x50, 0x60};
+            uint16_t nums[3];
+            bytes_to_numbers<uint16_t>(byts, 3, nums);
+            CHECK_EQUAL(0x1020, nums[0]);
+            CHECK_EQUAL(0x3040, nums[1]);
+            CHECK_EQUAL(0x5060, nums[2]);
+            bytes_to_numbers<uint16_t, 2, false>(byts, 1, nums);
+            CHECK_EQUAL(0x2010, nums[0]);
+        }
+        {
+            uint8_t byts[40];
+            for (size_t i = 0; i < 40; ++i) byts[i] = uint8_t(i + 1);
+            big_int<20> nums[2];
+            bytes_to_numbers<big_int<20>>(byts, 2, nums);
+            CHECK_EQUAL("102030405060708090a0b0c0d0e0f1011121314", describe(hex, nums[0]));
+            CHECK_EQUAL("15161718191a1b1c1d1e1f202122232425262728", describe(hex, nums[1]));
+        }
     }
 
     TEST(helper, make_factory) {
@@ -201,6 +219,26 @@ namespace ecc {
             CHECK_EQUAL(0x40, byts.at(2));
             CHECK_EQUAL(0x30, byts.at(3));
         }
+        {
+            const uint16_t nums[] = {0x1020, 0x3040};
+            uint8_t byts[4];
+            numbers_to_bytes<uint16_t>(nums, 2, byts);
+            CHECK_EQUAL(0x10, byts[0]);
+            CHECK_EQUAL(0x20, byts[1]);
+            CHECK_EQUAL(0x30, byts[2]);
+            CHECK_EQUAL(0x40, byts[3]);
+            numbers_to_bytes<uint16_t, 2, false>(nums, 1, byts);
+            CHECK_EQUAL(0x20, byts[0]);
+            CHECK_EQUAL(0x10, byts[1]);
+        }
+        {
+            const big_int<20> nums[] = {big_int<20>(1), big_int<20>(-1)};
+            uint8_t byts[40];
+            numbers_to_bytes<big_int<20>>(nums, 2, byts);
+            for (size_t i = 0; i < 19; ++i) CHECK_EQUAL(0, byts[i]);
+            CHECK_EQUAL(1, byts[19]);
+            for (size_t i = 20; i < 40; ++i) CHECK_EQUAL(0xff, byts[i]);
+        }
     }
 
     TEST(helper, object_getter) {
@@ -233,6 +271,23 @@ namespace ecc {
         }
     }
 
+    TEST(helper, pow_modulo) {
+        {
+            CHECK_EQUAL(24, pow_modulo(2, 10, 1000));
+            CHECK_EQUAL(1, pow_modulo(5, 0, 7));
+            CHECK_EQUAL(0, pow_modulo(5, 3, 1));
+        }
+        {
+            const auto p = big_int<20>("1461501637330902918203684832716283019653785059327");
+            CHECK_EQUAL(big_int<20>(1), pow_modulo(big_int<20>(3), p - big_int<20>(1), p));
+            const auto e = big_int<20>("10000000000000000000000000000000000000000");
+            CHECK_EQUAL(
+                "914412407704435786850490747284895542624360329156",
+                describe(pow_modulo(big_int<20>(5), e, p))
+            );
+        }
+    }
+
     TEST(helper, bits_to_bytes) {
         {
             vector<bool> bits({